@@ -0,0 +1,192 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
+#define LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ Includes
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class DofConstraints;
+
+/**
+ * A read-only, compressed copy of a \p DofConstraints matrix, in
+ * compressed sparse row form: the constrained dofs are kept sorted in
+ * one array, and the (dof, coefficient) entries of all their rows
+ * contiguously in another, so looking up a row is a binary search
+ * over a flat array rather than a walk down a tree of separately
+ * allocated nodes, and its entries share cache lines.
+ *
+ * A bitmap over the range of constrained dofs answers
+ * \p is_constrained() in constant time, which is the question the
+ * element constraint routines ask most often, and usually of
+ * unconstrained dofs.
+ *
+ * \p DofMap builds one of these once its constraints have been
+ * processed, and uses it in place of the map in
+ * \p is_constrained_dof() and the element constraint routines.  Any
+ * change to the underlying constraints invalidates it.
+ *
+ * \brief Compressed sparse row storage for DoF constraints.
+ */
+class CompressedDofConstraints
+{
+public:
+
+  /**
+   * A single constraint coefficient, laid out like the entries of a
+   * \p DofConstraintRow so the same code can iterate over either.
+   */
+  typedef std::pair<dof_id_type, Real> Entry;
+
+  /**
+   * The (possibly empty) row of a single constrained dof.
+   */
+  class Row
+  {
+  public:
+    typedef const Entry * const_iterator;
+
+    Row (const_iterator b, const_iterator e) : _begin(b), _end(e) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+
+  private:
+    const_iterator _begin, _end;
+  };
+
+  /**
+   * Constructor.  The store is empty and not built.
+   */
+  CompressedDofConstraints ();
+
+  /**
+   * Replaces the contents of this store with a copy of
+   * \p constraints.
+   */
+  void build (const DofConstraints & constraints);
+
+  /**
+   * Empties the store and marks it as not built.
+   */
+  void clear ();
+
+  /**
+   * Swaps the contents of two stores.
+   */
+  void swap (CompressedDofConstraints & other);
+
+  /**
+   * \returns \p true if \p build() has been called since the last
+   * \p clear().
+   */
+  bool built () const { return _built; }
+
+  /**
+   * \returns The number of constrained dofs.
+   */
+  std::size_t n_rows () const { return _dofs.size(); }
+
+  /**
+   * \returns The total number of constraint coefficients.
+   */
+  std::size_t n_entries () const { return _entries.size(); }
+
+  /**
+   * \returns \p true if \p dof is constrained.
+   */
+  bool is_constrained (const dof_id_type dof) const
+  {
+    return (dof >= _first_dof &&
+            dof - _first_dof < _constrained.size() &&
+            _constrained[dof - _first_dof]);
+  }
+
+  /**
+   * \returns The constraint row of \p dof, which must be constrained.
+   */
+  Row row (const dof_id_type dof) const;
+
+  /**
+   * \returns The index of the first constrained dof which is not
+   * less than \p dof, or \p n_rows() if there are none.  Together
+   * with \p dof() and \p row_at() this allows iterating over a range
+   * of constrained dofs, e.g. the local ones.
+   */
+  std::size_t lower_bound (const dof_id_type dof) const;
+
+  /**
+   * \returns The \p r th constrained dof.
+   */
+  dof_id_type dof (const std::size_t r) const
+  {
+    libmesh_assert_less (r, _dofs.size());
+    return _dofs[r];
+  }
+
+  /**
+   * \returns The row of the \p r th constrained dof.
+   */
+  Row row_at (const std::size_t r) const
+  {
+    libmesh_assert_less (r, _dofs.size());
+    return Row(_entries.empty() ? libmesh_nullptr : &_entries[0] + _offsets[r],
+               _entries.empty() ? libmesh_nullptr : &_entries[0] + _offsets[r+1]);
+  }
+
+private:
+
+  bool _built;
+
+  /**
+   * The constrained dofs, in ascending order.
+   */
+  std::vector<dof_id_type> _dofs;
+
+  /**
+   * The entries of row \p r are \p _entries[_offsets[r]] up to
+   * \p _entries[_offsets[r+1]].
+   */
+  std::vector<std::size_t> _offsets;
+
+  std::vector<Entry> _entries;
+
+  /**
+   * \p _constrained[i] is set iff dof \p _first_dof + i is
+   * constrained.
+   */
+  dof_id_type _first_dof;
+  std::vector<bool> _constrained;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
@@ -0,0 +1,202 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DOF_INDICES_CACHE_H
+#define LIBMESH_DOF_INDICES_CACHE_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/elem.h"
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class DofMap;
+
+/**
+ * A table of the global degree of freedom indices of a set of
+ * elements, as \p DofMap::dof_indices() would compute them, in
+ * compressed sparse row form: the indices of all the elements are
+ * kept contiguously in one array, variable by variable, with the
+ * offset of each (element, variable) pair in another.  Looking up an
+ * element is an index into an array by its id, and the indices are
+ * returned as a range into the table, so nothing is allocated or
+ * recomputed.
+ *
+ * \p DofMap builds one of these for its active local and ghosted
+ * elements after distributing dofs, if asked to with
+ * \p DofMap::set_cache_dof_indices(), and uses it in
+ * \p DofMap::dof_indices().  Any change to the mesh or to the dof
+ * numbering invalidates it.
+ *
+ * \brief Compressed sparse row storage for element DoF indices.
+ */
+class DofIndicesCache
+{
+public:
+
+  /**
+   * The (possibly empty) dof indices of one element, or of one
+   * variable on one element.
+   */
+  class Indices
+  {
+  public:
+    typedef const dof_id_type * const_iterator;
+
+    Indices (const_iterator b, const_iterator e) : _begin(b), _end(e) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+
+    dof_id_type operator[] (const std::size_t i) const
+    {
+      libmesh_assert_less (i, this->size());
+      return _begin[i];
+    }
+
+  private:
+    const_iterator _begin, _end;
+  };
+
+  /**
+   * Constructor.  The cache is empty and not built.
+   */
+  DofIndicesCache ();
+
+  /**
+   * Replaces the contents of this cache with the dof indices of
+   * \p elems, as currently numbered by \p dof_map.
+   */
+  void build (const DofMap & dof_map,
+              const std::vector<const Elem *> & elems);
+
+  /**
+   * Empties the cache and marks it as not built.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if \p build() has been called since the last
+   * \p clear().
+   */
+  bool built () const { return _built; }
+
+  /**
+   * \returns \p true if the indices of \p elem are in the cache.
+   */
+  bool contains (const Elem * elem) const
+  {
+    if (!elem)
+      return false;
+
+    const dof_id_type id = elem->id();
+    return (id < _slots.size() &&
+            _slots[id] != DofObject::invalid_id &&
+            _elems[_slots[id]] == elem);
+  }
+
+  /**
+   * \returns The dof indices of all the variables on \p elem, which
+   * must be in the cache.
+   */
+  Indices indices (const Elem * elem) const
+  {
+    libmesh_assert (this->contains(elem));
+    const std::size_t first = std::size_t(_slots[elem->id()]) * _n_vars;
+    return this->range(_offsets[first], _offsets[first + _n_vars]);
+  }
+
+  /**
+   * \returns The dof indices of the variable \p v on \p elem, which
+   * must be in the cache.
+   */
+  Indices indices (const Elem * elem,
+                   const unsigned int v) const
+  {
+    libmesh_assert (this->contains(elem));
+    libmesh_assert_less (v, _n_vars);
+    const std::size_t first = std::size_t(_slots[elem->id()]) * _n_vars + v;
+    return this->range(_offsets[first], _offsets[first + 1]);
+  }
+
+  /**
+   * \returns The number of elements in the cache.
+   */
+  std::size_t n_elem () const { return _elems.size(); }
+
+  /**
+   * \returns The total number of dof indices in the cache.
+   */
+  std::size_t n_indices () const { return _indices.size(); }
+
+  /**
+   * \returns The number of bytes the cache takes up.
+   */
+  std::size_t memory_usage () const;
+
+private:
+
+  Indices range (const std::size_t begin,
+                 const std::size_t end) const
+  {
+    return Indices(_indices.empty() ? libmesh_nullptr : &_indices[0] + begin,
+                   _indices.empty() ? libmesh_nullptr : &_indices[0] + end);
+  }
+
+  bool _built;
+
+  /**
+   * The number of variables of the \p DofMap we were built from.
+   */
+  unsigned int _n_vars;
+
+  /**
+   * The position in \p _elems of each cached element, by element id,
+   * or \p DofObject::invalid_id for elements not in the cache.
+   */
+  std::vector<dof_id_type> _slots;
+
+  /**
+   * The cached elements, so that an element which has replaced a
+   * cached one with the same id is not mistaken for it.
+   */
+  std::vector<const Elem *> _elems;
+
+  /**
+   * The indices of variable \p v on the element in slot \p s are
+   * \p _indices[_offsets[s*_n_vars+v]] up to
+   * \p _indices[_offsets[s*_n_vars+v+1]].
+   */
+  std::vector<std::size_t> _offsets;
+
+  std::vector<dof_id_type> _indices;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DOF_INDICES_CACHE_H
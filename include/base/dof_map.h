@@ -23,6 +23,8 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/compressed_dof_constraints.h"
+#include "libmesh/dof_indices_cache.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
@@ -682,6 +684,41 @@ public:
    */
   bool use_coupled_neighbor_dofs(const MeshBase & mesh) const;
 
+  /**
+   * Enables or disables the caching of element dof indices.  When
+   * enabled, the dof indices of the active local and ghosted
+   * elements are tabulated once dofs have been distributed, and
+   * \p dof_indices() reads them from the table instead of recomputing
+   * them.  The table is discarded whenever the mesh changes, and
+   * rebuilt the next time dofs are distributed.  This can also be
+   * enabled for all systems with the --cache_dof_indices
+   * commandline option.
+   */
+  void set_cache_dof_indices(bool cache_dof_indices);
+
+  /**
+   * \returns \p true if element dof indices are to be cached.
+   */
+  bool cache_dof_indices() const;
+
+  /**
+   * \returns The cached element dof indices, which will not be
+   * built unless caching is enabled and dofs have been distributed.
+   * Unlike \p dof_indices(), this allows reading the indices of
+   * cached elements without copying them.
+   */
+  const DofIndicesCache & get_dof_indices_cache() const
+  { return _dof_indices_cache; }
+
+  /**
+   * Builds the cache of element dof indices for the active local
+   * elements of \p mesh and the elements our ghosting functors ghost
+   * for them.  This is done by \p distribute_dofs() when caching is
+   * enabled, and can be repeated if the cache was discarded by a
+   * mesh change which left the dofs in place.
+   */
+  void build_dof_indices_cache (const MeshBase & mesh);
+
   /**
    * Builds the local element vector \p Ue from the global vector \p Ug,
    * accounting for any constrained degrees of freedom.  For an element
@@ -823,14 +860,25 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compressed_dof_constraints.swap(_stashed_compressed_dof_constraints);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compressed_dof_constraints.swap(_stashed_compressed_dof_constraints);
   }
 
+  /**
+   * \returns The compressed copy of the DoF constraints which
+   * \p process_constraints() builds.  It is not built, and should not
+   * be used, while the constraints are still being assembled or after
+   * \p add_constraint_row() has modified them.
+   */
+  const CompressedDofConstraints & get_compressed_dof_constraints() const
+  { return _compressed_dof_constraints; }
+
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
   /**
    * \returns An iterator pointing to the first Node constraint row.
@@ -1233,6 +1281,11 @@ public:
    */
   unsigned int sys_number() const;
 
+  /**
+   * \returns The mesh we distribute degrees of freedom on.
+   */
+  const MeshBase & get_mesh() const { return _mesh; }
+
 private:
 
   /**
@@ -1580,6 +1633,13 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * Compressed copies of the above, built by \p process_constraints()
+   * for faster lookups in the element constraint routines.
+   */
+  CompressedDofConstraints _compressed_dof_constraints,
+    _stashed_compressed_dof_constraints;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -1629,6 +1689,27 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * Bools to indicate if we override the --cache_dof_indices
+   * commandline option.
+   */
+  bool _cache_dof_indices_initialized;
+  bool _cache_dof_indices;
+
+  /**
+   * The cached element dof indices.
+   */
+  DofIndicesCache _dof_indices_cache;
+
+  /**
+   * A GhostingFunctor which ghosts nothing, but which the mesh tells
+   * about its changes so that it can clear \p _dof_indices_cache.
+   * It is attached to the mesh while caching is enabled.
+   *
+   * We use a UniquePtr here to reduce header dependencies.
+   */
+  UniquePtr<GhostingFunctor> _dof_indices_cache_invalidator;
 };
 
 
@@ -1722,6 +1803,9 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_compressed_dof_constraints.built())
+    return _compressed_dof_constraints.is_constrained(dof);
+
   if (_dof_constraints.count(dof))
     return true;
 
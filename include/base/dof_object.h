@@ -26,6 +26,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -471,9 +472,14 @@ private:
    * *within the system*. So for a system with 2 variable groups, 4 and 8 variables each,
    * the 5th variable in the system is the 1st variable in 2nd variable group.
    * (Now of course 0-base everything...  but you get the idea.)
+   *
+   * The buffer is stored inside the object as long as it has at most
+   * 6 entries, i.e. for one system with up to two variable groups or
+   * two systems with one variable group each, and only allocated on
+   * the heap beyond that.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  typedef small_vector<index_t, 6> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -502,7 +508,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -807,37 +813,35 @@ dof_id_type DofObject::dof_number(const unsigned int s,
   libmesh_assert_less (var,  this->n_vars(s));
   libmesh_assert_less (comp, this->n_comp(s,var));
 
-  const unsigned int
-    vg            = this->var_to_vg(s,var),
-    start_idx_sys = this->start_idx(s);
+  // Walk the variable groups of system s once, rather than finding
+  // the group, its component count and the variable's place in it
+  // separately.
+  const index_t * idx = _idx_buf.data() + this->start_idx(s);
 
-  libmesh_assert_less ((start_idx_sys + 2*vg + 1), _idx_buf.size());
+  for (unsigned int first_var = 0; ; idx += 2)
+    {
+      libmesh_assert_less (idx + 1, _idx_buf.data() + this->end_idx(s));
 
-  const dof_id_type
-    base_idx = _idx_buf[start_idx_sys + 2*vg + 1];
+      const unsigned int n_vars_vg =
+        cast_int<unsigned int>(idx[0] >> ncv_magic_exp);
 
-  // if the first component is invalid, they
-  // are all invalid
-  if (base_idx == invalid_id)
-    return invalid_id;
+      if (var < first_var + n_vars_vg)
+        {
+          const dof_id_type base_idx = idx[1];
 
-  // otherwise the index is the first component
-  // index augemented by the component number
-  else
-    {
-      const unsigned int
-        ncg = this->n_comp_group(s,vg),
-        vig = this->system_var_to_vg_var(s,vg,var);
-
-      // std::cout << "base_idx, var, vg, vig, ncg, comp="
-      // << base_idx << " "
-      // << var << " "
-      // << vg << " "
-      // << vig << " "
-      // << ncg << " "
-      // << comp << '\n';
-
-      return cast_int<dof_id_type>(base_idx + vig*ncg + comp);
+          // if the first component is invalid, they
+          // are all invalid
+          if (base_idx == invalid_id)
+            return invalid_id;
+
+          // otherwise the index is the first component
+          // index augemented by the component number
+          const unsigned int ncg = idx[0] % ncv_magic;
+
+          return cast_int<dof_id_type>(base_idx + (var - first_var)*ncg + comp);
+        }
+
+      first_var += n_vars_vg;
     }
 }
 
@@ -162,7 +162,8 @@ extern const Number imaginary;
  * The command-line is also checked, allowing the user to override the
  * compiled default.  For example, \p --use-petsc will force the use of
  * PETSc solvers, and \p --use-laspack will force the use of LASPACK
- * solvers.
+ * solvers.  \p --use-native selects the solvers built into libMesh,
+ * which are also the default when no other package is available.
  */
 SolverPackage default_solver_package ();
 
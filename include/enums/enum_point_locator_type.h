@@ -32,7 +32,8 @@ namespace libMesh {
 enum PointLocatorType {TREE = 0,
                        TREE_ELEMENTS,
                        TREE_LOCAL_ELEMENTS,
-                       INVALID_LOCATOR};
+                       INVALID_LOCATOR,
+                       BVH};
 }
 
 #endif // LIBMESH_ENUM_POINT_LOCATOR_TYPE_H
@@ -38,7 +38,9 @@ enum SolverPackage
     EIGEN_SOLVERS,
     NLOPT_SOLVERS,
 
-    INVALID_SOLVER_PACKAGE
+    INVALID_SOLVER_PACKAGE,
+
+    NATIVE_SOLVERS
   };
 }
 
@@ -67,6 +67,10 @@ public:
 
   /**
    * Register a user function to use in computing the essential BCs.
+   *
+   * \note The element loop is split across threads when libMesh
+   * runs with more than one, so \p fptr has to be safe to call
+   * concurrently.
    */
   void attach_essential_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                                const Point & p,
@@ -77,6 +81,20 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator for another thread to use.
+   * The essential BC function, if any, must be safe to call from several
+   * threads at once.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  {
+    libmesh_assert(typeid(*this) == typeid(DiscontinuityMeasure));
+    return UniquePtr<JumpErrorEstimator>(new DiscontinuityMeasure(*this));
+  }
+
+  virtual const std::type_info * clone_type() const libmesh_override
+  { return &typeid(DiscontinuityMeasure); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
@@ -60,6 +60,18 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator for another thread to use.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  {
+    libmesh_assert(typeid(*this) == typeid(LaplacianErrorEstimator));
+    return UniquePtr<JumpErrorEstimator>(new LaplacianErrorEstimator(*this));
+  }
+
+  virtual const std::type_info * clone_type() const libmesh_override
+  { return &typeid(LaplacianErrorEstimator); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
@@ -25,10 +25,13 @@
 #include "libmesh/dense_vector.h"
 #include "libmesh/error_estimator.h"
 #include "libmesh/fem_context.h"
+#include "libmesh/elem_range.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace libMesh
@@ -59,7 +62,22 @@ public:
       fine_context(),
       coarse_context(),
       fine_error(0),
-      coarse_error(0) {}
+      coarse_error(0),
+      var(0) {}
+
+  /**
+   * Copy constructor.  Copies the estimator settings, but not the
+   * per-estimate scratch contexts.
+   */
+  JumpErrorEstimator(const JumpErrorEstimator & other)
+    : ErrorEstimator(other),
+      scale_by_n_flux_faces(other.scale_by_n_flux_faces),
+      integrate_boundary_sides(other.integrate_boundary_sides),
+      fine_context(),
+      coarse_context(),
+      fine_error(0),
+      coarse_error(0),
+      var(0) {}
 
   /**
    * Destructor.
@@ -72,6 +90,10 @@ public:
    * estimate formula to estimate the error on each cell.
    * The estimated error is output in the vector
    * \p error_per_cell
+   *
+   * The active local elements are split among threads if the dynamic
+   * type of the estimator implements \p clone() and \p clone_type();
+   * otherwise they are all examined on the calling thread.
    */
   virtual void estimate_error (const System & system,
                                ErrorVector & error_per_cell,
@@ -89,6 +111,28 @@ public:
   bool scale_by_n_flux_faces;
 
 protected:
+  /**
+   * \returns A new estimator with the same settings as this one, to
+   * be used by another thread during \p estimate_error().  Derived
+   * classes whose side integrations only depend on their own settings
+   * and on the contexts can implement this with their copy
+   * constructor, along with \p clone_type().
+   *
+   * The default implementation returns \p NULL.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const;
+
+  /**
+   * \returns The type of the estimators \p clone() makes, or \p NULL
+   * if it makes none.  \p estimate_error() only uses threads when
+   * this is the dynamic type of the estimator, so a subclass which
+   * inherits the \p clone() of its parent runs serially rather than
+   * being sliced.  This is checked without calling \p clone().
+   *
+   * The default implementation returns \p NULL.
+   */
+  virtual const std::type_info * clone_type() const;
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -142,6 +186,47 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * Builds the fine and coarse contexts for \p system and gives the
+   * derived class a chance to initialize them.
+   */
+  void init_contexts (const System & system);
+
+  /**
+   * Class to compute the error contributions for a range of
+   * elements.  Each copy made for another thread uses its own clone
+   * of the estimator and its own error vectors, which are summed by
+   * \p join(), since the jump across a side is added to the elements
+   * on both sides of it.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   JumpErrorEstimator & ee,
+                   bool estimate_parent_error);
+
+    EstimateError (EstimateError & other, Threads::split);
+
+    void operator()(const ConstElemRange & range);
+
+    void join (const EstimateError & other);
+
+    std::vector<ErrorVectorReal> error_per_cell;
+
+    std::vector<float> n_flux_faces;
+
+  private:
+    const System & system;
+    UniquePtr<JumpErrorEstimator> cloned_estimator;
+    JumpErrorEstimator & error_estimator;
+    const bool estimate_parent_error;
+  };
+
+  friend class EstimateError;
 };
 
 
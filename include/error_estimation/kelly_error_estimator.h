@@ -81,6 +81,10 @@ public:
 
   /**
    * Register a user function to use in computing the flux BCs.
+   *
+   * \note With more than one thread the side integrations run
+   * concurrently, so \p fptr may be called from several threads at
+   * once and must be thread safe.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -91,6 +95,20 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator for another thread to use.
+   * The flux BC function, if any, must be safe to call from several
+   * threads at once.
+   */
+  virtual UniquePtr<JumpErrorEstimator> clone() const libmesh_override
+  {
+    libmesh_assert(typeid(*this) == typeid(KellyErrorEstimator));
+    return UniquePtr<JumpErrorEstimator>(new KellyErrorEstimator(*this));
+  }
+
+  virtual const std::type_info * clone_type() const libmesh_override
+  { return &typeid(KellyErrorEstimator); }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects.
@@ -28,6 +28,7 @@
 #include "libmesh/fe_type.h"
 #include "libmesh/auto_ptr.h"
 #include "libmesh/fe_map.h"
+#include "libmesh/tensor_product_shapes.h"
 
 // C++ includes
 #include <cstddef>
@@ -445,6 +446,14 @@ public:
    */
   const FEMap & get_fe_map() const { return *_fe_map.get(); }
 
+  /**
+   * \returns The sum factorization of the shape functions on the
+   * current element and quadrature rule, or \p NULL if they were
+   * not computed that way; see \p FEType::sum_factorization.
+   */
+  const TensorProductShapes * get_tensor_product_shapes() const
+  { return _tensor_product_shapes.active() ? &_tensor_product_shapes : libmesh_nullptr; }
+
   /**
    * Prints the Jacobian times the weight for each quadrature point.
    */
@@ -552,6 +561,17 @@ protected:
    */
   mutable bool calculate_dphiref;
 
+  /**
+   * Should we calculate shape functions in contiguous storage?
+   */
+  mutable bool calculate_phi_array;
+
+  /**
+   * Should we calculate shape function gradient components in
+   * contiguous storage?
+   */
+  mutable bool calculate_dphi_array;
+
 
   /**
    * The finite element type for this object.
@@ -583,6 +603,19 @@ protected:
    */
   bool shapes_on_quadrature;
 
+  /**
+   * The sum factorization of the shape functions, active only while
+   * they are on a tensor-product quadrature rule.
+   */
+  TensorProductShapes _tensor_product_shapes;
+
+  /**
+   * A flag indicating that \p init_shape_functions() already filled
+   * in \p phi from the \p ReferenceShapeCache, so it needs no mapping
+   * on each element.
+   */
+  bool _phi_from_cache;
+
   /**
    * \returns \p true when the shape functions (for
    * this \p FEFamily) depend on the particular
@@ -610,11 +643,14 @@ FEAbstract::FEAbstract(const unsigned int d,
   calculate_curl_phi(false),
   calculate_div_phi(false),
   calculate_dphiref(false),
+  calculate_phi_array(false),
+  calculate_dphi_array(false),
   fe_type(fet),
   elem_type(INVALID_ELEM),
   _p_level(0),
   qrule(libmesh_nullptr),
-  shapes_on_quadrature(false)
+  shapes_on_quadrature(false),
+  _phi_from_cache(false)
 {
 }
 
@@ -26,6 +26,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/fe_abstract.h"
+#include "libmesh/fe_shape_array.h"
 #include "libmesh/fe_transformation_base.h"
 #include "libmesh/point.h"
 #include "libmesh/reference_counted_object.h"
@@ -257,6 +258,44 @@ public:
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphidz; }
 
+  /**
+   * \returns The shape function values at the quadrature points, in
+   * contiguous, aligned storage.
+   *
+   * Requesting only the contiguous arrays (and not the nested-vector
+   * data returned by e.g. \p get_phi()) lets \p reinit() skip
+   * filling the nested vectors altogether.  The arrays are currently
+   * only filled by finite element types using the standard \p FE
+   * shape function computation with an H1 transformation.
+   */
+  const FEShapeArray<OutputShape> & get_phi_array() const
+  { libmesh_assert(!calculations_started || calculate_phi_array);
+    calculate_phi_array = true; return phi_array; }
+
+  /**
+   * \returns The shape function x-derivative at the quadrature
+   * points, in contiguous, aligned storage.
+   */
+  const FEShapeArray<OutputShape> & get_dphidx_array() const
+  { libmesh_assert(!calculations_started || calculate_dphi_array);
+    calculate_dphi_array = calculate_dphiref = true; return dphidx_array; }
+
+  /**
+   * \returns The shape function y-derivative at the quadrature
+   * points, in contiguous, aligned storage.
+   */
+  const FEShapeArray<OutputShape> & get_dphidy_array() const
+  { libmesh_assert(!calculations_started || calculate_dphi_array);
+    calculate_dphi_array = calculate_dphiref = true; return dphidy_array; }
+
+  /**
+   * \returns The shape function z-derivative at the quadrature
+   * points, in contiguous, aligned storage.
+   */
+  const FEShapeArray<OutputShape> & get_dphidz_array() const
+  { libmesh_assert(!calculations_started || calculate_dphi_array);
+    calculate_dphi_array = calculate_dphiref = true; return dphidz_array; }
+
   /**
    * \returns The shape function xi-derivative at the quadrature
    * points.
@@ -543,6 +582,29 @@ protected:
    */
   std::vector<std::vector<OutputShape> >   dphidz;
 
+  /**
+   * Shape function values, in contiguous storage.
+   */
+  FEShapeArray<OutputShape> phi_array;
+
+  /**
+   * Shape function derivatives in the x direction, in contiguous
+   * storage.
+   */
+  FEShapeArray<OutputShape> dphidx_array;
+
+  /**
+   * Shape function derivatives in the y direction, in contiguous
+   * storage.
+   */
+  FEShapeArray<OutputShape> dphidy_array;
+
+  /**
+   * Shape function derivatives in the z direction, in contiguous
+   * storage.
+   */
+  FEShapeArray<OutputShape> dphidz_array;
+
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
 
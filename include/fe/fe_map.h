@@ -26,6 +26,7 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/fe_shape_array.h"
 
 namespace libMesh
 {
@@ -902,10 +903,28 @@ private:
    */
   void compute_inverse_map_second_derivs(unsigned p);
 
+  /**
+   * A helper function used by FEMap::compute_map() to compute the
+   * first order map of a 3D element at all quadrature points at
+   * once.  This gives the same results as calling
+   * compute_single_point_map() at each point, but sums over the
+   * nodes into contiguous per-component rows and then inverts the
+   * Jacobians in one loop over points, both of which vectorize.
+   */
+  void compute_volume_map_3D(const std::vector<Real> & qw,
+                             const Elem * elem,
+                             const std::vector<const Node *> & elem_nodes);
+
   /**
    * Work vector for compute_affine_map()
    */
   std::vector<const Node *> elem_nodes;
+
+  /**
+   * Work space for compute_volume_map_3D(): rows hold x, y, z and
+   * then the nine entries of the Jacobian matrix at each point.
+   */
+  FEShapeArray<Real> _map_rows;
 };
 
 }
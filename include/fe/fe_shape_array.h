@@ -0,0 +1,250 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_ARRAY_H
+#define LIBMESH_FE_SHAPE_ARRAY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class stores a per-shape-function, per-quadrature-point
+ * quantity (e.g. \p phi or one component of \p dphi) in a single
+ * contiguous buffer, instead of the one-heap-allocation-per-row
+ * layout of a \p std::vector<std::vector<T> >.
+ *
+ * Entry \p [i][qp] lives at \p row_data(0)[i*stride()+qp].  The start of
+ * the buffer is aligned to \p alignment bytes, and when \p T evenly
+ * divides that alignment the row stride is padded up to a multiple
+ * of \p simd_width, so every row starts on an aligned boundary and
+ * loops over quadrature points can be vectorized without peeling.
+ * Padding entries are value-initialized and kept that way, so
+ * kernels may safely read (but should not rely on writing) the whole
+ * padded row.
+ *
+ * \p operator[] returns a lightweight row view supporting
+ * \p operator[], \p size() and iteration, so loops written against
+ * the nested-vector layout as \p phi[i][qp] work unchanged.
+ *
+ * \brief Contiguous, aligned storage for FE shape function data.
+ */
+template <typename T>
+class FEShapeArray
+{
+public:
+
+  /**
+   * The alignment, in bytes, of the start of the buffer.
+   */
+  static const std::size_t alignment = 64;
+
+  /**
+   * The number of entries each row stride is padded to a multiple
+   * of.
+   */
+  static const std::size_t simd_width =
+    (alignment % sizeof(T)) ? 1 : alignment / sizeof(T);
+
+  /**
+   * A read-only view of the values of one shape function at every
+   * point.
+   */
+  class const_row
+  {
+  public:
+    typedef const T * const_iterator;
+
+    const_row (const T * data, std::size_t size) :
+      _data(data), _size(size) {}
+
+    const T & operator[] (std::size_t qp) const
+    { libmesh_assert_less (qp, _size); return _data[qp]; }
+
+    std::size_t size () const { return _size; }
+
+    const T * data () const { return _data; }
+
+    const_iterator begin () const { return _data; }
+
+    const_iterator end () const { return _data + _size; }
+
+  private:
+    const T * _data;
+    std::size_t _size;
+  };
+
+  /**
+   * A writable view of the values of one shape function at every
+   * point.
+   */
+  class row
+  {
+  public:
+    typedef T * iterator;
+
+    row (T * data, std::size_t size) :
+      _data(data), _size(size) {}
+
+    operator const_row () const { return const_row(_data, _size); }
+
+    T & operator[] (std::size_t qp) const
+    { libmesh_assert_less (qp, _size); return _data[qp]; }
+
+    std::size_t size () const { return _size; }
+
+    T * data () const { return _data; }
+
+    iterator begin () const { return _data; }
+
+    iterator end () const { return _data + _size; }
+
+  private:
+    T * _data;
+    std::size_t _size;
+  };
+
+  FEShapeArray () :
+    _n_rows(0), _n_points(0), _stride(0), _offset(0) {}
+
+  FEShapeArray (const FEShapeArray & other) :
+    _n_rows(0), _n_points(0), _stride(0), _offset(0)
+  {
+    *this = other;
+  }
+
+  FEShapeArray & operator= (const FEShapeArray & other)
+  {
+    if (this != &other)
+      {
+        this->resize(other._n_rows, other._n_points);
+        for (std::size_t i = 0; i != _n_rows; ++i)
+          std::copy(other.row_data(i), other.row_data(i) + _n_points,
+                    this->row_data(i));
+      }
+    return *this;
+  }
+
+  /**
+   * Resizes to hold \p n_rows shape functions at \p n_points points
+   * each.  This does nothing, and keeps the existing values, if the
+   * size is unchanged; otherwise all values are reset.
+   */
+  void resize (std::size_t n_rows, std::size_t n_points)
+  {
+    if (n_rows == _n_rows && n_points == _n_points)
+      return;
+
+    _n_rows = n_rows;
+    _n_points = n_points;
+    _stride = (n_points + simd_width - 1) / simd_width * simd_width;
+
+    // Over-allocate by one SIMD width so we can shift the start of
+    // the rows onto an aligned address.
+    _storage.assign(_n_rows * _stride + simd_width, T());
+
+    _offset = 0;
+    if (simd_width > 1)
+      {
+        const std::size_t misalignment =
+          reinterpret_cast<std::size_t>(&_storage[0]) % alignment;
+        if (misalignment)
+          _offset = (alignment - misalignment) / sizeof(T);
+      }
+  }
+
+  /**
+   * Releases all storage.
+   */
+  void clear ()
+  {
+    std::vector<T>().swap(_storage);
+    _n_rows = _n_points = _stride = _offset = 0;
+  }
+
+  /**
+   * Copies values from the nested-vector layout, resizing to match.
+   * Every row of \p v must have the same size.
+   */
+  void assign (const std::vector<std::vector<T> > & v)
+  {
+    const std::size_t n_points = v.empty() ? 0 : v[0].size();
+    this->resize(v.size(), n_points);
+    for (std::size_t i = 0; i != _n_rows; ++i)
+      {
+        libmesh_assert_equal_to (v[i].size(), n_points);
+        std::copy(v[i].begin(), v[i].end(), this->row_data(i));
+      }
+  }
+
+  /**
+   * \returns The number of shape functions (rows) stored.
+   */
+  std::size_t size () const { return _n_rows; }
+
+  bool empty () const { return _n_rows == 0; }
+
+  /**
+   * \returns The number of points (row length) stored.
+   */
+  std::size_t n_points () const { return _n_points; }
+
+  /**
+   * \returns The distance between the starts of successive rows.
+   */
+  std::size_t stride () const { return _stride; }
+
+  /**
+   * \returns A pointer to the first value of row \p i.
+   */
+  T * row_data (std::size_t i)
+  {
+    libmesh_assert_less (i, _n_rows);
+    return &_storage[_offset + i * _stride];
+  }
+
+  const T * row_data (std::size_t i) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    return &_storage[_offset + i * _stride];
+  }
+
+  row operator[] (std::size_t i)
+  { return row(this->row_data(i), _n_points); }
+
+  const_row operator[] (std::size_t i) const
+  { return const_row(this->row_data(i), _n_points); }
+
+private:
+
+  std::size_t _n_rows, _n_points, _stride, _offset;
+
+  std::vector<T> _storage;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_ARRAY_H
@@ -19,6 +19,7 @@
 #define LIBMESH_FE_TRANSFORMATION_BASE_H
 
 #include "libmesh/fe_base.h"
+#include "libmesh/fe_shape_array.h"
 
 namespace libMesh
 {
@@ -89,6 +90,29 @@ public:
                         std::vector<std::vector<OutputShape> > & dphidy,
                         std::vector<std::vector<OutputShape> > & dphidz) const = 0;
 
+  /**
+   * Evaluates shape functions in physical coordinates, as in
+   * \p map_phi(), into contiguous storage.
+   */
+  virtual void map_phi_array(const unsigned int dim,
+                             const Elem * const elem,
+                             const std::vector<Point> & qp,
+                             const FEGenericBase<OutputShape> & fe,
+                             FEShapeArray<OutputShape> & phi) const = 0;
+
+  /**
+   * Evaluates the components of shape function gradients in
+   * physical coordinates, as in \p map_dphi(), into contiguous
+   * storage.
+   */
+  virtual void map_dphi_array(const unsigned int dim,
+                              const Elem * const elem,
+                              const std::vector<Point> & qp,
+                              const FEGenericBase<OutputShape> & fe,
+                              FEShapeArray<OutputShape> & dphidx,
+                              FEShapeArray<OutputShape> & dphidy,
+                              FEShapeArray<OutputShape> & dphidz) const = 0;
+
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
    * Evaluates shape function Hessians in physical coordinates based on proper
@@ -188,7 +188,8 @@ public:
   FEType(const int      o = 1,
          const FEFamily f = LAGRANGE) :
     order(o),
-    family(f)
+    family(f),
+    sum_factorization(false)
   {}
 
   /**
@@ -222,7 +223,8 @@ public:
     radial_order(ro),
     family(f),
     radial_family(rf),
-    inf_map(im)
+    inf_map(im),
+    sum_factorization(false)
   {}
 
   /**
@@ -258,6 +260,15 @@ public:
 
 #endif // ifndef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
+  /**
+   * Whether \p FE objects of this type should evaluate tensor-product
+   * shape functions by sum factorization when they can; see
+   * \p TensorProductShapes.  This only changes how the shape
+   * functions are computed, not the space they span, so it takes no
+   * part in comparisons between \p FETypes.  Defaults to \p false.
+   */
+  bool sum_factorization;
+
   /**
    * Tests equality
    */
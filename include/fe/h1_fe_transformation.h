@@ -84,6 +84,30 @@ public:
                         std::vector<std::vector<OutputShape> > & dphidy,
                         std::vector<std::vector<OutputShape> > & dphidz) const libmesh_override;
 
+  /**
+   * Evaluates shape functions in physical coordinates for H1
+   * conforming elements, into contiguous storage.
+   */
+  virtual void map_phi_array(const unsigned int dim,
+                             const Elem * const elem,
+                             const std::vector<Point> & qp,
+                             const FEGenericBase<OutputShape> & fe,
+                             FEShapeArray<OutputShape> & phi) const libmesh_override;
+
+  /**
+   * Evaluates the components of shape function gradients in physical
+   * coordinates for H1 conforming elements, into contiguous storage.
+   * The loops run over quadrature points on raw rows, so the compiler
+   * can vectorize them.
+   */
+  virtual void map_dphi_array(const unsigned int dim,
+                              const Elem * const elem,
+                              const std::vector<Point> & qp,
+                              const FEGenericBase<OutputShape> & fe,
+                              FEShapeArray<OutputShape> & dphidx,
+                              FEShapeArray<OutputShape> & dphidy,
+                              FEShapeArray<OutputShape> & dphidz) const libmesh_override;
+
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
    * Evaluates shape function Hessians in physical coordinates based
@@ -87,6 +87,34 @@ public:
     libmesh_warning("WARNING: Shape function gradients for HCurl elements are not currently being computed!");
   }
 
+  /**
+   * Contiguous shape function storage is not yet supported for
+   * \f$ H(curl) \f$ conforming elements.
+   */
+  virtual void map_phi_array(const unsigned int /*dim*/,
+                             const Elem * const /*elem*/,
+                             const std::vector<Point> & /*qp*/,
+                             const FEGenericBase<OutputShape> & /*fe*/,
+                             FEShapeArray<OutputShape> & /*phi*/) const libmesh_override
+  {
+    libmesh_not_implemented();
+  }
+
+  /**
+   * Contiguous shape function storage is not yet supported for
+   * \f$ H(curl) \f$ conforming elements.
+   */
+  virtual void map_dphi_array(const unsigned int /*dim*/,
+                              const Elem * const /*elem*/,
+                              const std::vector<Point> & /*qp*/,
+                              const FEGenericBase<OutputShape> & /*fe*/,
+                              FEShapeArray<OutputShape> & /*dphidx*/,
+                              FEShapeArray<OutputShape> & /*dphidy*/,
+                              FEShapeArray<OutputShape> & /*dphidz*/) const libmesh_override
+  {
+    libmesh_not_implemented();
+  }
+
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
    * Evaluates shape function Hessians in physical coordinates based
@@ -0,0 +1,193 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_REFERENCE_SHAPE_CACHE_H
+#define LIBMESH_REFERENCE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class is a process-wide cache of the reference-space shape
+ * function values and derivatives which
+ * \p FE<Dim,T>::init_shape_functions() computes, keyed by dimension,
+ * \p FEType, element type, p refinement level and the quadrature
+ * rule, i.e. its type, order and element type.
+ *
+ * Only finite element families whose shape functions do not depend
+ * on the physical element (i.e. for which \p shapes_need_reinit() is
+ * false, such as \p LAGRANGE and \p MONOMIAL) may use it.  Every \p FE
+ * object which is reinitialized on the same element type and
+ * quadrature rule then shares a single evaluation of the tables,
+ * rather than re-evaluating \p shape() and \p shape_deriv() at every
+ * point each time the element type or p level changes.
+ *
+ * Lookups and insertions are protected by a mutex, so the cache may
+ * be used from threaded assembly loops.  Tables are never modified
+ * once inserted, and are only freed by \p clear(), which must not be
+ * called while other threads may be reinitializing \p FE objects.
+ *
+ * Hit and miss counts are kept for profiling.
+ *
+ * \brief Shared cache of reference shape function tables.
+ */
+template <typename OutputShape>
+class ReferenceShapeCache
+{
+public:
+
+  /**
+   * Everything the reference tables depend on.
+   */
+  struct Key
+  {
+    Key () :
+      dim(0), elem_type(INVALID_ELEM), p_level(0),
+      values(false), first_derivatives(false), second_derivatives(false),
+      qrule_type(INVALID_Q_RULE), qrule_order(INVALID_ORDER),
+      qrule_elem_type(INVALID_ELEM), qrule_negative_weights(false),
+      n_points(0) {}
+
+    unsigned int dim;
+    FEType fe_type;
+    ElemType elem_type;
+    unsigned int p_level;
+    bool values;
+    bool first_derivatives;
+    bool second_derivatives;
+
+    /**
+     * The quadrature rule the points come from, which has to be one
+     * whose points only depend on these.  The number of points is a
+     * sanity check.
+     */
+    QuadratureType qrule_type;
+    Order qrule_order;
+    ElemType qrule_elem_type;
+    bool qrule_negative_weights;
+    unsigned int n_points;
+
+    bool operator< (const Key & other) const;
+  };
+
+  /**
+   * The reference shape function tables, laid out as in
+   * \p FEGenericBase.  Tables which were not requested when the entry
+   * was computed are left empty.
+   */
+  struct Tables
+  {
+    std::vector<std::vector<OutputShape> > phi;
+    std::vector<std::vector<OutputShape> > dphidxi, dphideta, dphidzeta;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<OutputShape> > d2phidxi2, d2phidxideta, d2phideta2,
+      d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns The cache shared by every \p FE object with this
+   * output type.
+   */
+  static ReferenceShapeCache & instance ();
+
+  /**
+   * \returns The tables stored for \p key, or \p NULL if there are
+   * none yet.  Counts a hit or a miss.
+   */
+  const Tables * find (const Key & key);
+
+  /**
+   * Stores a copy of \p tables for \p key, unless another thread got
+   * there first.
+   */
+  void insert (const Key & key, const Tables & tables);
+
+  /**
+   * Frees all cached tables and resets the counters.
+   */
+  void clear ();
+
+  /**
+   * Enables or disables caching; it is enabled by default.
+   * Disabling the cache keeps the tables already stored.
+   */
+  void enable (bool enabled = true) { _enabled = enabled; }
+
+  void disable () { this->enable(false); }
+
+  bool enabled () const { return _enabled; }
+
+  /**
+   * \returns The number of lookups which found cached tables.
+   */
+  std::size_t n_hits () const { return _n_hits; }
+
+  /**
+   * \returns The number of lookups which did not.
+   */
+  std::size_t n_misses () const { return _n_misses; }
+
+  /**
+   * \returns The number of distinct sets of tables stored.
+   */
+  std::size_t n_entries () const;
+
+  /**
+   * Prints the counters to \p os.
+   */
+  void print_info (std::ostream & os = libMesh::out) const;
+
+private:
+
+  ReferenceShapeCache ();
+
+  ~ReferenceShapeCache ();
+
+  // Not copyable
+  ReferenceShapeCache (const ReferenceShapeCache &);
+  ReferenceShapeCache & operator= (const ReferenceShapeCache &);
+
+  typedef std::map<Key, Tables *> map_type;
+
+  map_type _tables;
+
+  mutable Threads::spin_mutex _mutex;
+
+  bool _enabled;
+
+  std::size_t _n_hits, _n_misses;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_REFERENCE_SHAPE_CACHE_H
@@ -0,0 +1,312 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_SHAPES_H
+#define LIBMESH_TENSOR_PRODUCT_SHAPES_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+template <typename T> class DenseVectorBase;
+
+/**
+ * Describes one shape function of a tensor-product element as a
+ * product of 1D shape functions of the same family:
+ *
+ * phi_i(xi) = sign * prod_d phi1D[index[d]](+/- xi[coordinate[d]])
+ *
+ * where the minus sign is taken when \p reflected[d] is set.  The
+ * coordinates are permuted and reflected by the edge and face
+ * orientation logic of families like \p HIERARCHIC.
+ */
+struct TensorShapeFactors
+{
+  /**
+   * Constructor.  Defaults to the unpermuted, unreflected product
+   * of the given 1D shape functions.
+   */
+  TensorShapeFactors (const unsigned int i0 = 0,
+                      const unsigned int i1 = 0,
+                      const unsigned int i2 = 0) :
+    sign(1.)
+  {
+    index[0] = i0;
+    index[1] = i1;
+    index[2] = i2;
+    for (unsigned int d=0; d != 3; ++d)
+      {
+        coordinate[d] = d;
+        reflected[d] = false;
+      }
+  }
+
+  unsigned int index[3];
+  unsigned int coordinate[3];
+  bool reflected[3];
+  Real sign;
+};
+
+/**
+ * Fills \p factors for shape function \p i of the \p Dim dimensional
+ * family \p T, at total order \p totalorder, on \p elem.
+ *
+ * \returns \p false if that family is not a tensor product of its 1D
+ * shape functions on this element type and order (e.g. on
+ * serendipity elements), in which case \p factors is meaningless.
+ *
+ * Families which support sum factorization specialize this next to
+ * their shape functions, where the index and orientation logic
+ * lives; see \p TensorProductShapes.
+ */
+template <unsigned int Dim, FEFamily T>
+bool tensor_shape_factors (const Elem * elem,
+                           const Order totalorder,
+                           const unsigned int i,
+                           TensorShapeFactors & factors);
+
+
+
+/**
+ * This class evaluates the shape functions of \p QUAD and \p HEX
+ * elements of the \p LAGRANGE, \p HIERARCHIC, \p BERNSTEIN and
+ * \p SZABAB families by sum factorization, when they are evaluated at
+ * the points of a tensor-product quadrature rule such as \p QGauss or
+ * \p QGaussLobatto.
+ *
+ * At order p each such shape function is a product of 1D shape
+ * functions, so the 1D bases and their derivatives are tabulated once
+ * on the 1D rule and the element tables are built from products of
+ * those, rather than by evaluating every shape function at every
+ * point from scratch.  The 1D tables are only recomputed when the
+ * family, order or 1D rule change; on each element only the
+ * orientation-dependent mapping from shape functions to 1D factors
+ * is redone.
+ *
+ * On top of the tables, \p interpolate(), \p interpolate_gradient(),
+ * \p integrate() and \p integrate_gradient() apply the 1D bases one
+ * direction at a time, so evaluating a field at all quadrature points,
+ * or integrating against all test functions, costs O(p^(d+1)) rather
+ * than the O(p^(2d)) of a loop over shape functions and points.
+ *
+ * \p FE objects whose \p FEType has \p sum_factorization set use this
+ * class transparently; see \p FEAbstract::get_tensor_product_shapes().
+ *
+ * \brief Sum-factorized evaluation of tensor-product shape functions.
+ */
+class TensorProductShapes
+{
+public:
+
+  /**
+   * Constructor.  The object is inactive until \p reinit() succeeds.
+   */
+  TensorProductShapes ();
+
+  /**
+   * Factors the \p fe_type shape functions on \p elem, to be evaluated
+   * at the reference \p points.
+   *
+   * \returns \p true, and activates this object, if every shape
+   * function is a signed product of 1D shape functions of the family
+   * and \p points are the tensor product of a 1D rule, ordered as
+   * \p QBase orders them.  Otherwise deactivates this object and
+   * returns \p false.
+   */
+  bool reinit (const FEType & fe_type,
+               const Elem * elem,
+               const std::vector<Point> & points);
+
+  /**
+   * Deactivates this object.  The 1D tables are kept for reuse.
+   */
+  void clear () { _active = false; }
+
+  /**
+   * \returns \p true if the last \p reinit() succeeded.
+   */
+  bool active () const { return _active; }
+
+  /**
+   * \returns The dimension of the element.
+   */
+  unsigned int dim () const { return _dim; }
+
+  /**
+   * \returns The number of shape functions.
+   */
+  unsigned int n_shape_functions () const
+  { return cast_int<unsigned int>(_grid_index.size()); }
+
+  /**
+   * \returns The number of (tensor-product) points.
+   */
+  unsigned int n_points () const { return _n_points; }
+
+  /**
+   * Fills \p phi[i][qp], which must already be sized.
+   */
+  void compute_phi (std::vector<std::vector<Real> > & phi) const;
+
+  /**
+   * Fills the reference derivatives of the shape functions, which
+   * must already be sized.  Derivatives beyond \p dim() are ignored.
+   */
+  void compute_dphiref (std::vector<std::vector<Real> > & dphidxi,
+                        std::vector<std::vector<Real> > & dphideta,
+                        std::vector<std::vector<Real> > & dphidzeta) const;
+
+  /**
+   * Computes sum_i coefs(i) phi_i at every point.
+   */
+  void interpolate (const DenseVectorBase<Number> & coefs,
+                    std::vector<Number> & values) const;
+
+  /**
+   * Computes the reference gradient sum_i coefs(i) dphi_i/dxi at
+   * every point.
+   */
+  void interpolate_gradient (const DenseVectorBase<Number> & coefs,
+                             std::vector<Gradient> & gradients) const;
+
+  /**
+   * Adds sum_qp values[qp] phi_i(qp) to \p residual(i) for every
+   * shape function.  Quadrature weights are not applied, so
+   * \p values would usually already include \p JxW.
+   */
+  void integrate (const std::vector<Number> & values,
+                  DenseVectorBase<Number> & residual) const;
+
+  /**
+   * Adds sum_qp fluxes[qp] * dphi_i/dxi(qp) to \p residual(i), where
+   * \p fluxes are given with respect to the reference coordinates
+   * (i.e. already multiplied by the transpose of the inverse map
+   * Jacobian, and by \p JxW).
+   */
+  void integrate_gradient (const std::vector<Gradient> & fluxes,
+                           DenseVectorBase<Number> & residual) const;
+
+private:
+
+  /**
+   * Tabulates the 1D shape functions of \p family at \p totalorder on
+   * \p points_1D, and how each one reflects.  \returns \p false if the
+   * family has no 1D tensor-product basis.
+   */
+  bool init_1D (const FEFamily family,
+                const Order totalorder,
+                const std::vector<Real> & points_1D);
+
+  /**
+   * \returns The 1D points of which \p points are the \p dim
+   * dimensional tensor product, or an empty vector if they are not.
+   */
+  static std::vector<Real> points_1D (const unsigned int dim,
+                                      const std::vector<Point> & points);
+
+  /**
+   * Applies the \p n_out by \p n_in matrix \p matrix in direction
+   * \p d of the tensor \p in, whose extents are updated accordingly,
+   * writing the result to \p out.
+   */
+  void apply_1D (const std::vector<Real> & matrix,
+                 const unsigned int n_out,
+                 const unsigned int n_in,
+                 const unsigned int d,
+                 unsigned int (&extents)[3],
+                 const std::vector<Number> & in,
+                 std::vector<Number> & out) const;
+
+  /**
+   * Evaluates the tensor of 1D shape function coefficients in
+   * \p _work[0], differentiated in direction \p deriv (or not at all,
+   * if \p deriv is \p dim()), leaving the values at the points in
+   * \p _work[0].
+   */
+  void evaluate_grid (const unsigned int deriv) const;
+
+  /**
+   * Integrates the point values in \p _work[0] against the 1D shape
+   * functions, differentiated in direction \p deriv (or not at all),
+   * leaving the result in \p _work[0].
+   */
+  void integrate_grid (const unsigned int deriv) const;
+
+  bool _active;
+
+  unsigned int _dim;
+
+  FEFamily _family;
+
+  Order _totalorder;
+
+  /**
+   * The number of 1D shape functions and points.
+   */
+  unsigned int _n_shapes_1D, _n_points_1D;
+
+  unsigned int _n_points;
+
+  /**
+   * The points the 1D tables were computed on.
+   */
+  std::vector<Real> _points_1D;
+
+  /**
+   * The 1D shape function values and derivatives, as
+   * \p _n_points_1D by \p _n_shapes_1D matrices, and their
+   * transposes.
+   */
+  std::vector<Real> _phi_1D, _dphi_1D, _phi_1D_t, _dphi_1D_t;
+
+  /**
+   * 1D shape function k at -xi is \p _reflection_sign[k] times shape
+   * function \p _reflection[k] at xi, or \p _reflection[k] is
+   * \p libMesh::invalid_uint if the basis has no such symmetry.
+   */
+  std::vector<unsigned int> _reflection;
+  std::vector<Real> _reflection_sign;
+
+  /**
+   * Shape function i is \p _sign[i] times the tensor-product basis
+   * function with 1D indices \p _grid_index[i] = k0 + n*(k1 + n*k2).
+   */
+  std::vector<unsigned int> _grid_index;
+  std::vector<Real> _sign;
+
+  /**
+   * Scratch tensors for the sum-factorized kernels.
+   */
+  mutable std::vector<Number> _work[2];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_SHAPES_H
@@ -27,6 +27,7 @@
 #include "libmesh/id_types.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/node.h"
+#include "libmesh/slab_pool.h"
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_elem_quality.h"
 #include "libmesh/enum_order.h"
@@ -79,11 +80,15 @@ class PointLocatorBase;
  * Hex8 is a 3D hexahedral element. A \p Hex8 has 6 sides, which are
  * \p Faces of type Quad4.
  *
+ * Elements are allocated from a \p SlabPool, in which elements of
+ * each size get their own slabs of objects.
+ *
  * \author Benjamin S. Kirk
  * \date 2002-2007
  * \brief The base class for all geometric element types.
  */
 class Elem : public ReferenceCountedObject<Elem>,
+             public PoolAllocatedObject<Elem>,
              public DofObject
 {
 protected:
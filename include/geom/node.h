@@ -24,6 +24,7 @@
 #include "libmesh/point.h"
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/slab_pool.h"
 #include "libmesh/auto_ptr.h"
 
 // C++ includes
@@ -45,13 +46,16 @@ class MeshRefinement;
  * global \p id.  Finally, a \p Node may have an arbitrary number of
  * degrees of freedom associated with it.
  *
+ * Nodes are allocated from slabs of a \p SlabPool.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  * \brief A geometric point in (x,y,z) space associated with a DOF.
  */
 class Node : public Point,
              public DofObject,
-             public ReferenceCountedObject<Node>
+             public ReferenceCountedObject<Node>,
+             public PoolAllocatedObject<Node>
 {
 
 public:
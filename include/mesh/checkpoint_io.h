@@ -34,6 +34,7 @@
 namespace libMesh
 {
 // Forward declarations
+class AsyncFileWriter;
 class Xdr;
 
 /**
@@ -105,6 +106,29 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if we should write the per-processor
+   * files in the native layout: a fixed header with section offsets
+   * followed by contiguous, native-endian arrays of ids, element
+   * data, connectivity, coordinates and boundary conditions.  These
+   * files are not portable between machines, but read() maps them
+   * into memory and builds the mesh straight from the arrays, which
+   * is much faster than decoding them value by value.  read()
+   * detects the layout on its own.
+   */
+  bool   native() const { return _native; }
+  bool & native()       { return _native; }
+
+  /**
+   * Get/Set the writer to stage files in.  When this is set, write()
+   * builds the checkpoint files in memory, hands them to the writer
+   * to be written in the background and returns without waiting for
+   * the disk; call \p AsyncFileWriter::wait() before relying on the
+   * files.
+   */
+  AsyncFileWriter *   async_writer() const { return _async_writer; }
+  AsyncFileWriter *&  async_writer()       { return _async_writer; }
+
   /**
    * Get/Set the version string.
    */
@@ -181,6 +205,13 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write part of a mesh to the file \p file_name in the native layout
+   */
+  void write_native (const std::string & file_name,
+                     const std::set<const Elem *, CompareElemIdsByLevel> & elements,
+                     const std::set<const Node *> & nodeset) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -219,6 +250,11 @@ private:
    */
   void read_bc_names(Xdr & io, BoundaryInfo & info, bool is_sideset);
 
+  /**
+   * Read part of a mesh from the file \p file_name in the native layout
+   */
+  void read_native (const std::string & file_name);
+
   /**
    * \returns The number of levels of refinement in the active mesh on
    * this processor.
@@ -232,6 +268,8 @@ private:
 
   bool _binary;
   bool _parallel;
+  bool _native;
+  AsyncFileWriter * _async_writer;
   std::string _version;
   unsigned int _mesh_dimension;
 
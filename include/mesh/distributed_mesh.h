@@ -21,9 +21,14 @@
 #define LIBMESH_DISTRIBUTED_MESH_H
 
 // Local Includes
-#include "libmesh/mapvector.h"
 #include "libmesh/unstructured_mesh.h"
 
+#ifdef LIBMESH_ENABLE_CHUNKED_STORAGE
+#include "libmesh/chunked_mapvector.h"
+#else
+#include "libmesh/mapvector.h"
+#endif
+
 // C++ Includes
 #include <cstddef>
 #include <set>
@@ -148,8 +153,8 @@ public:
    * of a parallel objects container.
    * Calls libmesh_assert() on each possible failure in that container.
    */
-  template <typename T>
-  void libmesh_assert_valid_parallel_object_ids(const mapvector<T *,dof_id_type> &) const;
+  template <typename Container>
+  void libmesh_assert_valid_parallel_object_ids(const Container &) const;
 
   /**
    * Verify id and processor_id consistency of our elements and
@@ -176,8 +181,8 @@ public:
    *
    * \returns The smallest globally unused id for that container.
    */
-  template <typename T>
-  dof_id_type renumber_dof_objects (mapvector<T *,dof_id_type> &);
+  template <typename Container>
+  dof_id_type renumber_dof_objects (Container &);
 
   /**
    * Remove NULL elements from arrays
@@ -506,15 +511,29 @@ public:
 
 protected:
 
+  /**
+   * The containers used to store nodes and elements.  By default
+   * these are chunked arrays indexed by id, laid out to match the
+   * processor stride of the ids we hand out; configuring with
+   * --disable-chunked-storage reverts to std::map based storage.
+   */
+#ifdef LIBMESH_ENABLE_CHUNKED_STORAGE
+  typedef chunked_mapvector<Node *, dof_id_type> node_container;
+  typedef chunked_mapvector<Elem *, dof_id_type> elem_container;
+#else
+  typedef mapvector<Node *, dof_id_type> node_container;
+  typedef mapvector<Elem *, dof_id_type> elem_container;
+#endif
+
   /**
    * The verices (spatial coordinates) of the mesh.
    */
-  mapvector<Node *, dof_id_type> _nodes;
+  node_container _nodes;
 
   /**
    * The elements in the mesh.
    */
-  mapvector<Elem *, dof_id_type> _elements;
+  elem_container _elements;
 
   /**
    * A boolean remembering whether we're serialized or not
@@ -556,18 +575,23 @@ protected:
 private:
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Elem *>.
+   * Lays out the node and element containers for the ids we hand
+   * out: contiguous below the current maximum ids, and strided by
+   * processor above.
+   */
+  void reset_id_layout ();
+
+  /**
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Elem *, dof_id_type>::veclike_iterator             elem_iterator_imp;
-  typedef mapvector<Elem *, dof_id_type>::const_veclike_iterator const_elem_iterator_imp;
+  typedef elem_container::veclike_iterator             elem_iterator_imp;
+  typedef elem_container::const_veclike_iterator const_elem_iterator_imp;
 
   /**
-   * Typedefs for the container implementation.  In this case,
-   * it's just a std::vector<Node *>.
+   * Typedefs for the container implementation.
    */
-  typedef mapvector<Node *, dof_id_type>::veclike_iterator             node_iterator_imp;
-  typedef mapvector<Node *, dof_id_type>::const_veclike_iterator const_node_iterator_imp;
+  typedef node_container::veclike_iterator             node_iterator_imp;
+  typedef node_container::const_veclike_iterator const_node_iterator_imp;
 };
 
 
@@ -31,6 +31,7 @@
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/topology_map.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
 
 // C++ Includes
 #include <vector>
@@ -40,7 +41,6 @@ namespace libMesh
 
 // Forward Declarations
 class MeshBase;
-class Point;
 class Node;
 class ErrorVector;
 class PeriodicBoundaries;
@@ -691,6 +691,15 @@ private:
    */
   void update_nodes_map ();
 
+  /**
+   * Finds the node bracketed by \p bracketing_nodes in the
+   * \p _new_nodes_map, or adds a new one at \p p if there is none.
+   * The processor_id is assigned as in \p add_node().
+   */
+  Node * add_bracketed_node (const std::vector<std::pair<dof_id_type, dof_id_type> > & bracketing_nodes,
+                             const Point & p,
+                             processor_id_type proc_id);
+
   /**
    * Take user-specified coarsening flags and augment them
    * so that level-one dependency is satisfied.
@@ -851,6 +860,42 @@ private:
                                                   NeighborType nt,
                                                   unsigned max_mismatch);
 
+  /**
+   * Function object which flags the elements of a range which
+   * violate a node level mismatch limit, used by
+   * limit_level_mismatch_at_node().
+   */
+  class FlagNodeLevelMismatch;
+  friend class FlagNodeLevelMismatch;
+
+  /**
+   * Where a node of a child element comes from: either the node
+   * \p parent_node of its parent, or (if that is \p invalid_uint) the
+   * new node with the given bracketing nodes and location.
+   */
+  struct PreparedNode
+  {
+    unsigned int parent_node;
+    std::vector<std::pair<dof_id_type, dof_id_type> > bracketing_nodes;
+    Point p;
+  };
+
+  /**
+   * Function object which computes the \p PreparedNode data for the
+   * children of each element of a range, used by _refine_elements().
+   */
+  class PrepareChildNodes;
+  friend class PrepareChildNodes;
+
+  /**
+   * The element currently being refined by _refine_elements(), and
+   * the node data prepared for its children ahead of time, indexed by
+   * child and then by child node.  add_node() uses this data rather
+   * than recomputing it.  Both are \p NULL when no data is prepared.
+   */
+  const Elem * _prepared_parent;
+  const std::vector<std::vector<PreparedNode> > * _prepared_nodes;
+
 #ifdef LIBMESH_ENABLE_PERIODIC
   PeriodicBoundaries * _periodic_boundaries;
 #endif
@@ -0,0 +1,126 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PVTU_IO_H
+#define LIBMESH_PVTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/mesh_output.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * This class writes meshes and nodal data in the VTK XML parallel
+ * unstructured grid format, without needing the VTK library, and
+ * without ever gathering the mesh or the solution onto one processor.
+ *
+ * Every processor writes its active local elements, the nodes they
+ * touch and the nodal data at those nodes to its own "piece", a
+ * \p .vtu file with the data appended as raw binary.  Processor 0
+ * additionally writes the \p .pvtu index, which only lists the pieces
+ * and the names of the data arrays, so it needs nothing from the
+ * other processors.  A \p DistributedMesh is written as it is, and
+ * nodal values are fetched from the parallel solution vector only
+ * for the (local and ghost) nodes of each piece.
+ *
+ * For a file name "out.pvtu" the pieces are "out_0.vtu", "out_1.vtu",
+ * etc., in the same directory.  ParaView and VisIt both read the
+ * result directly.
+ *
+ * \brief Parallel writer for the VTK XML unstructured grid format.
+ */
+class PVTUIO : public MeshOutput<MeshBase>
+{
+public:
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   */
+  explicit
+  PVTUIO (const MeshBase &);
+
+  /**
+   * Writes the mesh, without any nodal data.
+   */
+  virtual void write (const std::string &) libmesh_override;
+
+  /**
+   * Bring in base class functionality for name resolution and to
+   * avoid warnings about hidden overloaded virtual functions.
+   */
+  using MeshOutput<MeshBase>::write_nodal_data;
+
+  /**
+   * Writes the mesh with nodal data, which is taken from a node-major
+   * \p soln vector which must be complete on every processor.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const std::vector<Number> &,
+                                 const std::vector<std::string> &) libmesh_override;
+
+  /**
+   * Writes the mesh with nodal data, taken from a node-major
+   * \p parallel_soln vector like the one
+   * \p EquationSystems::build_parallel_solution_vector() builds.
+   * Each processor only retrieves the entries of its own piece.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) libmesh_override;
+
+  /**
+   * \returns The name of the piece processor \p pid writes for the
+   * index file \p fname.
+   */
+  static std::string piece_name (const std::string & fname,
+                                 const processor_id_type pid);
+
+private:
+
+  /**
+   * Fills \p nodes with the sorted ids of the nodes of the active
+   * local elements.
+   */
+  void piece_nodes (std::vector<dof_id_type> & nodes) const;
+
+  /**
+   * Writes this processor's piece, with the \p names.size() values of
+   * each of the \p nodes (in node-major order) taken from \p values,
+   * and if this is processor 0 writes the index file \p fname.
+   */
+  void write_files (const std::string & fname,
+                    const std::vector<dof_id_type> & nodes,
+                    const std::vector<Number> & values,
+                    const std::vector<std::string> & names);
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PVTU_IO_H
@@ -0,0 +1,444 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+#define LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/elem_range.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+template <typename T> class NativeLinearSolver;
+
+/**
+ * A parallel sparse matrix in compressed sparse row format which
+ * needs no external library.  Each processor stores its own rows,
+ * which it builds directly from the full sparsity pattern computed by
+ * the \p DofMap, so the matrix never allocates during assembly.
+ *
+ * When the sparsity pattern is set, the position of every entry of
+ * the element matrix of each active local element is looked up once
+ * and stored, so that \p add_matrix() called with the dof indices of
+ * an element is a plain scatter into the matrix values.  The elements
+ * are also split into colors, such that no two elements of a color
+ * add to the same local row, even through their constraints.  Element
+ * matrices of one color may be added concurrently, e.g. from a
+ * \p Threads::parallel_for() over \p element_color_range(c), without
+ * any locking.  Entries of rows owned by other processors, and
+ * entries outside the sparsity pattern, are stashed under a lock and
+ * moved into place by \p close().
+ *
+ * Matrix-vector products are threaded over the local rows, and get
+ * the off-processor entries of the vector with a sparse exchange
+ * between neighboring processors only.
+ *
+ * All overridden virtual functions are documented in sparse_matrix.h.
+ *
+ * \brief Native threaded CSR sparse matrix.
+ */
+template <typename T>
+class DistributedSparseMatrix libmesh_final : public SparseMatrix<T>
+{
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure, i.e.  the matrix is not usable at all. This
+   * constructor is therefore only useful for matrices which are
+   * members of a class. All other matrices should be created at a
+   * point in the data flow where all necessary information is
+   * available.
+   *
+   * You have to initialize the matrix before usage with \p init(...).
+   */
+  explicit
+  DistributedSparseMatrix (const Parallel::Communicator & comm
+                           LIBMESH_CAN_DEFAULT_TO_COMMWORLD);
+
+  /**
+   * Destructor.
+   */
+  ~DistributedSparseMatrix ();
+
+  /**
+   * The \p DistributedSparseMatrix is built from the full sparsity
+   * pattern.
+   */
+  virtual bool need_full_sparsity_pattern() const libmesh_override
+  { return true; }
+
+  /**
+   * Builds the compressed rows from the sparsity pattern of our
+   * local rows, and the element matrix positions and colors of the
+   * active local elements of the mesh of the \p DofMap.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph &) libmesh_override;
+
+  /**
+   * Initializes an empty matrix of the given sizes; \p nnz, \p noz
+   * and \p blocksize are ignored.  Every entry then added is outside
+   * the sparsity pattern, so the structure is built by the first
+   * \p close().
+   */
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) libmesh_override;
+
+  virtual void init () libmesh_override;
+
+  virtual void clear () libmesh_override;
+
+  virtual void zero () libmesh_override;
+
+  virtual void zero_rows (std::vector<numeric_index_type> & rows,
+                          T diag_value = 0.0) libmesh_override;
+
+  /**
+   * Sends stashed entries to the processors owning their rows, merges
+   * entries added outside the sparsity pattern into it, and sets up
+   * the communication of matrix-vector products.
+   */
+  virtual void close () libmesh_override;
+
+  virtual numeric_index_type m () const libmesh_override { return _m; }
+
+  virtual numeric_index_type n () const libmesh_override { return _n; }
+
+  virtual numeric_index_type row_start () const libmesh_override;
+
+  virtual numeric_index_type row_stop () const libmesh_override;
+
+  /**
+   * Sets the entry \p (i,j), which must be in a local row.
+   */
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) libmesh_override;
+
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) libmesh_override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) libmesh_override;
+
+  /**
+   * Adds the element matrix \p dm, using the stored positions of its
+   * entries if \p dof_indices are the indices of an active local
+   * element.
+   */
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) libmesh_override;
+
+  /**
+   * Compute A += a*X for scalar \p a, matrix \p X, which must also be
+   * a \p DistributedSparseMatrix with the same row distribution.
+   */
+  virtual void add (const T a, SparseMatrix<T> & X) libmesh_override;
+
+  /**
+   * \returns The entry \p (i,j), which must be in a local row.
+   */
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const libmesh_override;
+
+  virtual Real l1_norm () const libmesh_override;
+
+  virtual Real linfty_norm () const libmesh_override;
+
+  virtual bool closed() const libmesh_override { return _closed; }
+
+  /**
+   * Prints the nonzero entries of the local rows.
+   */
+  virtual void print_personal(std::ostream & os=libMesh::out) const libmesh_override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const libmesh_override;
+
+  /**
+   * Copies the transpose of this matrix into \p dest, which must also
+   * be a \p DistributedSparseMatrix.
+   */
+  virtual void get_transpose (SparseMatrix<T> & dest) const libmesh_override;
+
+  /**
+   * Computes \p dest += A*arg, threaded over the local rows.  This is
+   * what \p SparseMatrix::vector_mult_add() ends up calling for a
+   * \p DistributedVector.
+   */
+  void multiply_add (NumericVector<T> & dest,
+                     const NumericVector<T> & arg) const;
+
+  /**
+   * Computes \p dest += A^T*arg.
+   */
+  void multiply_add_transpose (NumericVector<T> & dest,
+                               const NumericVector<T> & arg) const;
+
+  /**
+   * Computes y += A*x, for vectors given by their local entries.  On
+   * entry \p x holds the local entries of the argument; it is resized
+   * to hold the off-processor entries the product needs after them.
+   * \p y holds the local rows.
+   */
+  void local_multiply_add (std::vector<T> & x,
+                           std::vector<T> & y) const;
+
+  /**
+   * Computes y += A^T*x, for vectors given by their local entries.
+   */
+  void local_multiply_add_transpose (const std::vector<T> & x,
+                                     std::vector<T> & y) const;
+
+  /**
+   * \returns The number of colors the active local elements were
+   * split into by \p update_sparsity_pattern().
+   */
+  unsigned int n_element_colors () const
+  { return cast_int<unsigned int>(_element_colors.size()); }
+
+  /**
+   * \returns A range over the elements of color \p c, no two of which
+   * add to the same local row, for use with \p Threads::parallel_for().
+   */
+  ConstElemRange element_color_range (const unsigned int c) const;
+
+  /**
+   * \returns The number of element matrices whose entry positions are
+   * stored.
+   */
+  std::size_t n_element_slots () const { return _element_slots.size(); }
+
+private:
+
+  /**
+   * The positions of the entries of one element matrix.
+   */
+  struct ElementSlots
+  {
+    // A hash of the dof indices, by which the slots are sorted
+    std::size_t key;
+
+    // The dof indices are _element_dofs[dofs_begin] up to
+    // _element_dofs[dofs_begin+n_dofs], and the position in its
+    // compressed row of entry (i,j) is
+    // _element_positions[positions_begin + i*n_dofs + j]
+    std::size_t dofs_begin;
+    std::size_t positions_begin;
+    unsigned int n_dofs;
+
+    bool operator< (const ElementSlots & other) const
+    { return key < other.key; }
+  };
+
+  /**
+   * Sets the global and local sizes, and gathers the row and column
+   * distribution of all processors.  The matrix is left with empty
+   * rows.
+   */
+  void init_sizes (const numeric_index_type m,
+                   const numeric_index_type n,
+                   const numeric_index_type m_l,
+                   const numeric_index_type n_l);
+
+  /**
+   * \returns The position of entry \p (i,j) of local row \p i in
+   * \p _vals, or \p invalid_pos if it is not in the sparsity pattern.
+   */
+  std::size_t pos (const numeric_index_type i,
+                   const numeric_index_type j) const;
+
+  /**
+   * Adds (or sets) an entry outside the sparsity pattern or in
+   * another processor's row.  Locks the stash.
+   */
+  void stash (const numeric_index_type i,
+              const numeric_index_type j,
+              const T value,
+              const bool insert);
+
+  /**
+   * Finds the element matrix positions stored for \p dof_indices.
+   */
+  const ElementSlots * find_element_slots (const std::vector<numeric_index_type> & dof_indices) const;
+
+  /**
+   * Stores the element matrix positions and colors of the active
+   * local elements of the \p DofMap's mesh.
+   */
+  void build_element_slots ();
+
+  /**
+   * Looks up the stored element matrix positions again, after the
+   * sparsity pattern has changed.
+   */
+  void update_element_positions ();
+
+  /**
+   * Merges the entries in \p _new_entries into the sparsity pattern.
+   */
+  void merge_new_entries ();
+
+  /**
+   * Works out which off-processor vector entries matrix-vector
+   * products need, and tells their owners.
+   */
+  void build_halo ();
+
+  /**
+   * Appends the entries in \p _ghost_cols, from the processors owning
+   * them, to the local entries of the vector \p x.
+   */
+  void gather_ghosts (std::vector<T> & x) const;
+
+  /**
+   * \returns The processor owning row \p i.
+   */
+  processor_id_type row_owner (const numeric_index_type i) const;
+
+  /**
+   * \returns The processor owning the entries of column \p j of
+   * vectors multiplied by the matrix.
+   */
+  processor_id_type col_owner (const numeric_index_type j) const;
+
+  static const std::size_t invalid_pos = static_cast<std::size_t>(-1);
+
+  /**
+   * The global sizes of the matrix.
+   */
+  numeric_index_type _m, _n;
+
+  /**
+   * The first row, and the first column of vectors, on each
+   * processor, followed by the global sizes.
+   */
+  std::vector<numeric_index_type> _first_rows, _first_cols;
+
+  /**
+   * The entries of local row \p i are \p _cols[k] and \p _vals[k] for
+   * \p k from \p _row_offsets[i-row_start()] up to (but not
+   * including) \p _row_offsets[i-row_start()+1], sorted by column.
+   */
+  std::vector<std::size_t> _row_offsets;
+  std::vector<numeric_index_type> _cols;
+  std::vector<T> _vals;
+
+  /**
+   * Entries of local rows which are not in the sparsity pattern.
+   */
+  std::map<std::pair<numeric_index_type, numeric_index_type>, T> _new_entries;
+
+  /**
+   * Row and column pairs, and values, to be added to the rows of
+   * other processors.
+   */
+  std::map<processor_id_type, std::vector<numeric_index_type> > _nonlocal_indices;
+  std::map<processor_id_type, std::vector<T> > _nonlocal_values;
+
+  /**
+   * Guards the stashed entries.
+   */
+  Threads::spin_mutex _stash_mutex;
+
+  std::vector<ElementSlots> _element_slots;
+  std::vector<numeric_index_type> _element_dofs;
+  std::vector<unsigned int> _element_positions;
+
+  /**
+   * The active local elements, by color.
+   */
+  std::vector<std::vector<const Elem *> > _element_colors;
+
+  /**
+   * The columns of our rows owned by other processors, sorted.
+   */
+  std::vector<numeric_index_type> _ghost_cols;
+
+  /**
+   * The column of each entry in \p _cols as an index into the local
+   * entries of a vector followed by the entries in \p _ghost_cols.
+   */
+  std::vector<numeric_index_type> _local_cols;
+
+  /**
+   * The local vector entries each other processor needs.
+   */
+  std::map<processor_id_type, std::vector<numeric_index_type> > _send_indices;
+
+  /**
+   * Whether \p _ghost_cols and friends are up to date.
+   */
+  bool _halo_built;
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  bool _closed;
+
+  /**
+   * The native solver builds its preconditioners from our rows.
+   */
+  friend class NativeLinearSolver<T>;
+};
+
+
+
+//-----------------------------------------------------------------------
+// DistributedSparseMatrix inline members
+template <typename T>
+inline
+numeric_index_type DistributedSparseMatrix<T>::row_start () const
+{
+  libmesh_assert (this->initialized());
+
+  return _first_rows[this->processor_id()];
+}
+
+
+
+template <typename T>
+inline
+numeric_index_type DistributedSparseMatrix<T>::row_stop () const
+{
+  libmesh_assert (this->initialized());
+
+  return _first_rows[this->processor_id()+1];
+}
+
+} // namespace libMesh
+
+
+#endif // #ifndef LIBMESH_DISTRIBUTED_SPARSE_MATRIX_H
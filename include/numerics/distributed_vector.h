@@ -36,6 +36,10 @@
 namespace libMesh
 {
 
+// Forward declarations
+template <typename T> class DistributedSparseMatrix;
+template <typename T> class NativeLinearSolver;
+
 /**
  * This class provides a simple parallel, distributed vector datatype
  * which is specific to libmesh. Offers some collective communication
@@ -183,13 +187,21 @@ public:
    */
   using NumericVector<T>::add_vector;
 
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) libmesh_override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A \vec{v} \f$.
+   *
+   * \note Only implemented for a \p DistributedSparseMatrix \p A.
+   */
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) libmesh_override;
 
-  virtual void add_vector_transpose (const NumericVector<T> &,
-                                     const SparseMatrix<T> &) libmesh_override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A^T \vec{v} \f$.
+   *
+   * \note Only implemented for a \p DistributedSparseMatrix \p A.
+   */
+  virtual void add_vector_transpose (const NumericVector<T> & v,
+                                     const SparseMatrix<T> & A) libmesh_override;
 
   virtual void scale (const T factor) libmesh_override;
 
@@ -245,6 +257,17 @@ private:
    * The last component (+1) stored locally.
    */
   numeric_index_type _last_local_index;
+
+  /**
+   * Make the native matrix a friend, so matrix-vector products can
+   * work on our values directly.
+   */
+  friend class DistributedSparseMatrix<T>;
+
+  /**
+   * The native solver iterates on our values directly too.
+   */
+  friend class NativeLinearSolver<T>;
 };
 
 
@@ -21,7 +21,7 @@
 #define LIBMESH_FEM_FUNCTION_BASE_H
 
 // C++ includes
-
+#include <vector>
 
 
 // Local Includes
@@ -124,6 +124,21 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Sets \p output to the vector component \p i at each of the
+   * coordinates \p p at time \p time.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation calls \p component() for each point.
+   * Functions which can evaluate many points for less than the cost
+   * of as many single evaluations should override it.
+   */
+  virtual void component_batch(const FEMContext &,
+                               unsigned int i,
+                               const std::vector<Point> & p,
+                               Real time,
+                               std::vector<Output> & output);
 };
 
 template <typename Output>
@@ -138,6 +153,19 @@ Output FEMFunctionBase<Output>::component (const FEMContext & context,
   return outvec(i);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::component_batch (const FEMContext & context,
+                                               unsigned int i,
+                                               const std::vector<Point> & p,
+                                               Real time,
+                                               std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t q = 0; q != p.size(); ++q)
+    output[q] = this->component(context, i, p[q], time);
+}
+
 template <typename Output>
 inline
 void FEMFunctionBase<Output>::operator() (const FEMContext & context,
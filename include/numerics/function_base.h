@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -136,6 +137,20 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Sets \p output to the vector component \p i at each of the
+   * coordinates \p p at time \p time.
+   *
+   * \note Subclasses aren't required to override this, since the
+   * default implementation calls \p component() for each point.
+   * Functions which can evaluate many points for less than the cost
+   * of as many single evaluations should override it.
+   */
+  virtual void component_batch(unsigned int i,
+                               const std::vector<Point> & p,
+                               Real time,
+                               std::vector<Output> & output);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -238,6 +253,20 @@ Output FunctionBase<Output>::component (unsigned int i,
 
 
 
+template <typename Output>
+inline
+void FunctionBase<Output>::component_batch (unsigned int i,
+                                            const std::vector<Point> & p,
+                                            Real time,
+                                            std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t q = 0; q != p.size(); ++q)
+    output[q] = this->component(i, p[q], time);
+}
+
+
+
 template <typename Output>
 inline
 void FunctionBase<Output>::operator() (const Point & p,
@@ -0,0 +1,681 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VECTOR_KERNELS_H
+#define LIBMESH_VECTOR_KERNELS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/tensor_tools.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Loops over the local entries of vectors stored in plain arrays, as
+ * used by \p DistributedVector and \p NativeLinearSolver.  Loops over
+ * at least \p min_threaded_size entries are split over
+ * \p libMesh::n_threads() threads; each piece is a simple loop over
+ * contiguous arrays which the compiler can vectorize.
+ *
+ * Some kernels fuse operations which Krylov methods do one after the
+ * other, e.g. an axpy and the norm of its result, so that the vectors
+ * involved are read only once.  All the reductions here are local to
+ * the processor: callers sum them over the communicator, several at a
+ * time where they can.
+ */
+namespace VectorKernels
+{
+
+/**
+ * Loops shorter than this run on the calling thread only.
+ */
+const std::size_t min_threaded_size = 8192;
+
+/**
+ * \returns \p true if a loop over \p n entries should be threaded.
+ */
+inline
+bool threaded (const std::size_t n)
+{
+  return n >= min_threaded_size &&
+    libMesh::n_threads() > 1 &&
+    !Threads::in_threads;
+}
+
+/**
+ * \returns A pointer to the entries of \p v, which may be empty.
+ */
+template <typename T>
+inline
+T * data (std::vector<T> & v)
+{
+  return v.empty() ? libmesh_nullptr : &v[0];
+}
+
+template <typename T>
+inline
+const T * data (const std::vector<T> & v)
+{
+  return v.empty() ? libmesh_nullptr : &v[0];
+}
+
+typedef Threads::BlockedRange<std::size_t> KernelRange;
+
+/**
+ * Thread body applying \p op to a range of entries.
+ */
+template <typename Op>
+class ForBody
+{
+public:
+  explicit ForBody (const Op & op) : _op(op) {}
+
+  void operator() (const KernelRange & range) const
+  { _op.apply(range.begin(), range.end()); }
+
+private:
+  const Op & _op;
+};
+
+/**
+ * Thread body accumulating \p op over a range of entries.
+ */
+template <typename Op>
+class ReduceBody
+{
+public:
+  explicit ReduceBody (const Op & op) : _op(op), result(op.identity()) {}
+
+  ReduceBody (ReduceBody & other, Threads::split) :
+    _op(other._op), result(other._op.identity()) {}
+
+  void operator() (const KernelRange & range)
+  { _op.accumulate(range.begin(), range.end(), result); }
+
+  void join (const ReduceBody & other)
+  { _op.combine(result, other.result); }
+
+private:
+  const Op & _op;
+
+public:
+  typename Op::value_type result;
+};
+
+/**
+ * Calls \p op.apply(begin, end) over the entries [0, n).
+ */
+template <typename Op>
+inline
+void for_each (const std::size_t n, const Op & op)
+{
+  if (threaded(n))
+    Threads::parallel_for (KernelRange(0, n), ForBody<Op>(op));
+  else
+    op.apply(0, n);
+}
+
+/**
+ * \returns \p op.accumulate() over the entries [0, n), with the
+ * results of different threads joined by \p op.combine().
+ */
+template <typename Op>
+inline
+typename Op::value_type reduce (const std::size_t n, const Op & op)
+{
+  if (threaded(n))
+    {
+      ReduceBody<Op> body(op);
+      Threads::parallel_reduce (KernelRange(0, n), body);
+      return body.result;
+    }
+
+  typename Op::value_type result = op.identity();
+  op.accumulate(0, n, result);
+  return result;
+}
+
+
+
+/**
+ * A pair of partial results which are summed.
+ */
+template <typename T1, typename T2>
+struct SumPair
+{
+  SumPair (const T1 & a, const T2 & b) : first(a), second(b) {}
+  T1 first;
+  T2 second;
+};
+
+
+
+// The operations below are small functors; the functions after them
+// are what callers should use.
+
+template <typename T>
+struct SumOp
+{
+  typedef T value_type;
+  const T * x;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a += b; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    T s = 0;
+    for (std::size_t i = begin; i < end; ++i)
+      s += x[i];
+    r += s;
+  }
+};
+
+template <typename T>
+struct L1NormOp
+{
+  typedef Real value_type;
+  const T * x;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a += b; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    Real s = 0;
+    for (std::size_t i = begin; i < end; ++i)
+      s += std::abs(x[i]);
+    r += s;
+  }
+};
+
+template <typename T>
+struct NormSqOp
+{
+  typedef Real value_type;
+  const T * x;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a += b; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    Real s = 0;
+    for (std::size_t i = begin; i < end; ++i)
+      s += TensorTools::norm_sq(x[i]);
+    r += s;
+  }
+};
+
+template <typename T>
+struct LinftyNormOp
+{
+  typedef Real value_type;
+  const T * x;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a = std::max(a, b); }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    for (std::size_t i = begin; i < end; ++i)
+      r = std::max(r, static_cast<Real>(std::abs(x[i])));
+  }
+};
+
+template <typename T>
+struct DotOp
+{
+  typedef T value_type;
+  const T * x;
+  const T * y;
+  bool conj;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a += b; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    T s = 0;
+    if (conj)
+      for (std::size_t i = begin; i < end; ++i)
+        s += libmesh_conj(x[i]) * y[i];
+    else
+      for (std::size_t i = begin; i < end; ++i)
+        s += x[i] * y[i];
+    r += s;
+  }
+};
+
+template <typename T>
+struct InnerPairOp
+{
+  typedef SumPair<T, T> value_type;
+  const T * x;
+  const T * y;
+  const T * z;
+  value_type identity () const { return value_type(0, 0); }
+  void combine (value_type & a, const value_type & b) const
+  { a.first += b.first; a.second += b.second; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    T xy = 0, xz = 0;
+    for (std::size_t i = begin; i < end; ++i)
+      {
+        const T xi = libmesh_conj(x[i]);
+        xy += xi * y[i];
+        xz += xi * z[i];
+      }
+    r.first += xy;
+    r.second += xz;
+  }
+};
+
+template <typename T>
+struct MultiInnerOp
+{
+  typedef std::vector<T> value_type;
+  std::size_t k;
+  const T * const * v;
+  const T * w;
+  value_type identity () const { return value_type(k, 0); }
+  void combine (value_type & a, const value_type & b) const
+  {
+    for (std::size_t j = 0; j != k; ++j)
+      a[j] += b[j];
+  }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    for (std::size_t j = 0; j != k; ++j)
+      {
+        const T * vj = v[j];
+        T s = 0;
+        for (std::size_t i = begin; i < end; ++i)
+          s += libmesh_conj(vj[i]) * w[i];
+        r[j] += s;
+      }
+  }
+};
+
+template <typename T>
+struct AxpyNormSqInnerOp
+{
+  typedef SumPair<Real, T> value_type;
+  T a;
+  const T * x;
+  T * y;
+  const T * w;
+  value_type identity () const { return value_type(0, 0); }
+  void combine (value_type & r, const value_type & b) const
+  { r.first += b.first; r.second += b.second; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & r) const
+  {
+    Real yy = 0;
+    T wy = 0;
+    if (w)
+      for (std::size_t i = begin; i < end; ++i)
+        {
+          y[i] += a * x[i];
+          yy += TensorTools::norm_sq(y[i]);
+          wy += libmesh_conj(w[i]) * y[i];
+        }
+    else
+      for (std::size_t i = begin; i < end; ++i)
+        {
+          y[i] += a * x[i];
+          yy += TensorTools::norm_sq(y[i]);
+        }
+    r.first += yy;
+    r.second += wy;
+  }
+};
+
+template <typename T>
+struct PointwiseMultInnerOp
+{
+  typedef T value_type;
+  const T * d;
+  const T * r;
+  T * z;
+  value_type identity () const { return 0; }
+  void combine (value_type & a, const value_type & b) const { a += b; }
+  void accumulate (std::size_t begin, std::size_t end, value_type & s) const
+  {
+    T rz = 0;
+    for (std::size_t i = begin; i < end; ++i)
+      {
+        z[i] = d[i] * r[i];
+        rz += libmesh_conj(r[i]) * z[i];
+      }
+    s += rz;
+  }
+};
+
+template <typename T>
+struct AddScalarOp
+{
+  T a;
+  T * x;
+  void apply (std::size_t begin, std::size_t end) const
+  {
+    for (std::size_t i = begin; i < end; ++i)
+      x[i] += a;
+  }
+};
+
+template <typename T>
+struct ScaleOp
+{
+  T a;
+  T * x;
+  void apply (std::size_t begin, std::size_t end) const
+  {
+    for (std::size_t i = begin; i < end; ++i)
+      x[i] *= a;
+  }
+};
+
+template <typename T>
+struct AxpbypczOp
+{
+  T a, b, c;
+  const T * x;
+  const T * y;
+  T * z;
+  void apply (std::size_t begin, std::size_t end) const
+  {
+    if (y)
+      for (std::size_t i = begin; i < end; ++i)
+        z[i] = a * x[i] + b * y[i] + c * z[i];
+    else
+      for (std::size_t i = begin; i < end; ++i)
+        z[i] = a * x[i] + c * z[i];
+  }
+};
+
+template <typename T>
+struct MultiAxpyOp
+{
+  std::size_t k;
+  const T * a;
+  const T * const * v;
+  T * w;
+  void apply (std::size_t begin, std::size_t end) const
+  {
+    for (std::size_t j = 0; j != k; ++j)
+      {
+        const T aj = a[j];
+        const T * vj = v[j];
+        for (std::size_t i = begin; i < end; ++i)
+          w[i] += aj * vj[i];
+      }
+  }
+};
+
+template <typename T>
+struct PointwiseOp
+{
+  const T * x;
+  const T * y;
+  T * z;
+  bool divide;
+  void apply (std::size_t begin, std::size_t end) const
+  {
+    if (divide)
+      for (std::size_t i = begin; i < end; ++i)
+        z[i] = x[i] / y[i];
+    else
+      for (std::size_t i = begin; i < end; ++i)
+        z[i] = x[i] * y[i];
+  }
+};
+
+
+
+/**
+ * \returns The sum of the entries of \p x.
+ */
+template <typename T>
+inline
+T sum (const std::size_t n, const T * x)
+{
+  SumOp<T> op = {x};
+  return reduce(n, op);
+}
+
+/**
+ * \returns The sum of the absolute values of the entries of \p x.
+ */
+template <typename T>
+inline
+Real l1_norm (const std::size_t n, const T * x)
+{
+  L1NormOp<T> op = {x};
+  return reduce(n, op);
+}
+
+/**
+ * \returns The square of the l2 norm of \p x.
+ */
+template <typename T>
+inline
+Real norm_sq (const std::size_t n, const T * x)
+{
+  NormSqOp<T> op = {x};
+  return reduce(n, op);
+}
+
+/**
+ * \returns The largest absolute value of the entries of \p x.
+ */
+template <typename T>
+inline
+Real linfty_norm (const std::size_t n, const T * x)
+{
+  LinftyNormOp<T> op = {x};
+  return reduce(n, op);
+}
+
+/**
+ * \returns \f$ \sum_i x_i y_i \f$, without complex conjugation, as
+ * \p NumericVector::dot() defines it.
+ */
+template <typename T>
+inline
+T dot (const std::size_t n, const T * x, const T * y)
+{
+  DotOp<T> op = {x, y, false};
+  return reduce(n, op);
+}
+
+/**
+ * \returns The inner product \f$ \sum_i \bar{x}_i y_i \f$.
+ */
+template <typename T>
+inline
+T inner (const std::size_t n, const T * x, const T * y)
+{
+  DotOp<T> op = {x, y, true};
+  return reduce(n, op);
+}
+
+/**
+ * Computes the inner products of \p x with both \p y and \p z in one
+ * pass over \p x.
+ */
+template <typename T>
+inline
+void inner_pair (const std::size_t n, const T * x, const T * y, const T * z,
+                 T & xy, T & xz)
+{
+  InnerPairOp<T> op = {x, y, z};
+  const SumPair<T, T> r = reduce(n, op);
+  xy = r.first;
+  xz = r.second;
+}
+
+/**
+ * Computes the inner products \f$ h_j = (v_j, w) \f$ of \p w with the
+ * \p k vectors \p v, e.g. for a classical Gram-Schmidt step.
+ */
+template <typename T>
+inline
+void multi_inner (const std::size_t n, const std::size_t k,
+                  const T * const * v, const T * w, T * h)
+{
+  MultiInnerOp<T> op = {k, v, w};
+  const std::vector<T> r = reduce(n, op);
+  std::copy(r.begin(), r.end(), h);
+}
+
+/**
+ * Computes \f$ y \leftarrow y + a x \f$ and \returns the square of
+ * the l2 norm of the result.
+ */
+template <typename T>
+inline
+Real axpy_norm_sq (const std::size_t n, const T a, const T * x, T * y)
+{
+  AxpyNormSqInnerOp<T> op = {a, x, y, libmesh_nullptr};
+  return reduce(n, op).first;
+}
+
+/**
+ * Computes \f$ y \leftarrow y + a x \f$, and the square of the l2
+ * norm of the result along with its inner product with \p w.
+ */
+template <typename T>
+inline
+void axpy_norm_sq_inner (const std::size_t n, const T a, const T * x, T * y,
+                         const T * w, Real & yy, T & wy)
+{
+  AxpyNormSqInnerOp<T> op = {a, x, y, w};
+  const SumPair<Real, T> r = reduce(n, op);
+  yy = r.first;
+  wy = r.second;
+}
+
+/**
+ * Computes \f$ z_i = d_i r_i \f$ and \returns the inner product of
+ * \p r and \p z, as a Jacobi preconditioned CG iteration needs.
+ */
+template <typename T>
+inline
+T pointwise_mult_inner (const std::size_t n, const T * d, const T * r, T * z)
+{
+  PointwiseMultInnerOp<T> op = {d, r, z};
+  return reduce(n, op);
+}
+
+/**
+ * Adds \p a to every entry of \p x.
+ */
+template <typename T>
+inline
+void add_scalar (const std::size_t n, const T a, T * x)
+{
+  AddScalarOp<T> op = {a, x};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ x \leftarrow a x \f$.
+ */
+template <typename T>
+inline
+void scale (const std::size_t n, const T a, T * x)
+{
+  ScaleOp<T> op = {a, x};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ y \leftarrow y + a x \f$.
+ */
+template <typename T>
+inline
+void axpy (const std::size_t n, const T a, const T * x, T * y)
+{
+  AxpbypczOp<T> op = {a, 0, 1, x, libmesh_nullptr, y};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ y \leftarrow x + a y \f$.
+ */
+template <typename T>
+inline
+void aypx (const std::size_t n, const T a, const T * x, T * y)
+{
+  AxpbypczOp<T> op = {1, 0, a, x, libmesh_nullptr, y};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ z \leftarrow a x + b y + c z \f$.
+ */
+template <typename T>
+inline
+void axpbypcz (const std::size_t n,
+               const T a, const T * x,
+               const T b, const T * y,
+               const T c, T * z)
+{
+  AxpbypczOp<T> op = {a, b, c, x, y, z};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ w \leftarrow w + \sum_j a_j v_j \f$ over the \p k
+ * vectors \p v.
+ */
+template <typename T>
+inline
+void multi_axpy (const std::size_t n, const std::size_t k,
+                 const T * a, const T * const * v, T * w)
+{
+  MultiAxpyOp<T> op = {k, a, v, w};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ z_i = x_i y_i \f$.
+ */
+template <typename T>
+inline
+void pointwise_mult (const std::size_t n, const T * x, const T * y, T * z)
+{
+  PointwiseOp<T> op = {x, y, z, false};
+  for_each(n, op);
+}
+
+/**
+ * Computes \f$ z_i = x_i / y_i \f$.
+ */
+template <typename T>
+inline
+void pointwise_divide (const std::size_t n, const T * x, const T * y, T * z)
+{
+  PointwiseOp<T> op = {x, y, z, true};
+  for_each(n, op);
+}
+
+} // namespace VectorKernels
+
+} // namespace libMesh
+
+#endif // LIBMESH_VECTOR_KERNELS_H
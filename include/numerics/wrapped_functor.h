@@ -76,6 +76,13 @@ public:
                             Real time=0.) libmesh_override
   { return _func->component(i, p, time); }
 
+  virtual void component_batch (const FEMContext &,
+                                unsigned int i,
+                                const std::vector<Point> & p,
+                                Real time,
+                                std::vector<Output> & output) libmesh_override
+  { _func->component_batch(i, p, time, output); }
+
 protected:
 
   UniquePtr<FunctionBase<Output> > _func;
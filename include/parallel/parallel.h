@@ -23,6 +23,7 @@
 #include "libmesh/libmesh_common.h" // libmesh_assert, cast_int
 #include "libmesh/libmesh_logging.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/id_types.h" // processor_id_type
 
 // C++ includes
 #include <cstddef>
@@ -748,6 +749,12 @@ private:
   mutable std::map<int, unsigned int> used_tag_values;
   bool          _I_duped_it;
 
+  // The number of sparse_exchange() calls made so far; successive
+  // calls alternate message tags, so that a processor which has
+  // already moved on to the next exchange can't send data to a
+  // processor still finishing the previous one.
+  mutable unsigned int _n_sparse_exchanges;
+
   // Communication operations:
 public:
 
@@ -1299,6 +1306,47 @@ public:
   template <typename T>
   inline void alltoall(std::vector<T> & r) const;
 
+  /**
+   * Sparse data exchange: sends each vector \p data[p] to processor
+   * \p p, and calls
+   * \p act_on_data(processor_id_type pid, std::vector<T> & received)
+   * once for every vector received, including any we sent to
+   * ourselves.  The received vectors are temporaries which
+   * \p act_on_data may modify or swap from.
+   *
+   * Only processors which actually have data for each other
+   * communicate: the number of incoming messages is discovered with a
+   * nonblocking consensus (synchronous sends followed by a
+   * nonblocking barrier) rather than with O(P) send_receive() loops
+   * or collectives, so the cost scales with the number of neighbors
+   * rather than with the size of the communicator.
+   *
+   * \p T may be any type with a StandardType, or a std::vector of
+   * such types.  This function must be run on all processors at
+   * once, and \p act_on_data must not itself communicate.
+   */
+  template <typename T, typename ActionFunctor>
+  inline void sparse_exchange(const std::map<processor_id_type, std::vector<T> > & data,
+                              ActionFunctor & act_on_data) const;
+
+  /**
+   * Sparse request/response exchange built from two
+   * sparse_exchange() rounds.  Each vector \p queries[p] is sent to
+   * processor \p p, which fills a response with
+   * \p gather_data(processor_id_type pid, const std::vector<T> & query,
+   *                std::vector<datum> & response);
+   * each response is sent back and handed to
+   * \p act_on_data(processor_id_type pid, const std::vector<T> & query,
+   *                std::vector<datum> & response)
+   * on the querying processor.  The \p example argument is only used
+   * to deduce \p datum, and may be NULL.
+   */
+  template <typename T, typename datum, typename GatherFunctor, typename ActionFunctor>
+  inline void sparse_query(const std::map<processor_id_type, std::vector<T> > & queries,
+                           GatherFunctor & gather_data,
+                           ActionFunctor & act_on_data,
+                           const datum * example) const;
+
   /**
    * Take a local value and broadcast it to all processors.
    * Optionally takes the \p root_id processor, which specifies
@@ -174,6 +174,196 @@ struct SyncEverything
 
 
 
+// Functors adapting a SyncFunctor to Communicator::sparse_query().
+// Each "gather" functor translates the queries it receives into the
+// ids of the requested local objects, then gathers the user's data
+// for them; the "act" functors hand each response back to the user
+// along with the ids of the objects we asked about.
+
+template <typename SyncFunctor>
+struct SyncGatherById
+{
+  SyncGatherById(SyncFunctor & sync) : _sync(sync) {}
+
+  void operator() (processor_id_type,
+                   const std::vector<dof_id_type> & ids,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    _sync.gather_data(ids, data);
+  }
+
+  SyncFunctor & _sync;
+};
+
+
+
+template <typename DofObjType, typename SyncFunctor>
+struct SyncGatherByXyz
+{
+  SyncGatherByXyz(LocationMap<DofObjType> & location_map,
+                  SyncFunctor & sync) :
+    _location_map(location_map), _sync(sync) {}
+
+  // Queries are (x,y,z) triples
+  void operator() (processor_id_type,
+                   const std::vector<Real> & xyz,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    libmesh_assert_equal_to (xyz.size() % 3, 0);
+
+    std::vector<dof_id_type> request_to_fill_id(xyz.size() / 3);
+    for (std::size_t i=0; i != request_to_fill_id.size(); ++i)
+      {
+        Point pt(xyz[3*i], xyz[3*i+1], xyz[3*i+2]);
+
+        // Look for this object in the multimap
+        DofObjType * obj = _location_map.find(pt);
+
+        // We'd better find every object we're asked for
+        libmesh_assert (obj);
+
+        // Return the object's correct processor id,
+        // and our (correct if it's local) id for it.
+        request_to_fill_id[i] = obj->id();
+      }
+
+    _sync.gather_data(request_to_fill_id, data);
+  }
+
+  LocationMap<DofObjType> & _location_map;
+  SyncFunctor & _sync;
+};
+
+
+
+template <typename SyncFunctor>
+struct SyncGatherByParentId
+{
+  SyncGatherByParentId(MeshBase & mesh, SyncFunctor & sync) :
+    _mesh(mesh), _sync(sync) {}
+
+  // Queries are (parent id, child number) pairs
+  void operator() (processor_id_type,
+                   const std::vector<dof_id_type> & parent_child,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    libmesh_assert_equal_to (parent_child.size() % 2, 0);
+
+    std::vector<dof_id_type> request_to_fill_id(parent_child.size() / 2);
+    for (std::size_t i=0; i != request_to_fill_id.size(); ++i)
+      {
+        Elem & parent = _mesh.elem_ref(parent_child[2*i]);
+        libmesh_assert(parent.has_children());
+        Elem * child = parent.child_ptr
+          (cast_int<unsigned int>(parent_child[2*i+1]));
+        libmesh_assert(child);
+        libmesh_assert(child->active());
+        request_to_fill_id[i] = child->id();
+      }
+
+    _sync.gather_data(request_to_fill_id, data);
+  }
+
+  MeshBase & _mesh;
+  SyncFunctor & _sync;
+};
+
+
+
+template <typename SyncFunctor>
+struct SyncGatherByElemNode
+{
+  SyncGatherByElemNode(MeshBase & mesh, SyncFunctor & sync) :
+    _mesh(mesh), _sync(sync) {}
+
+  // Queries are (element id, local node number) pairs
+  void operator() (processor_id_type,
+                   const std::vector<dof_id_type> & elem_node,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    libmesh_assert_equal_to (elem_node.size() % 2, 0);
+
+    std::vector<dof_id_type> request_to_fill_id(elem_node.size() / 2);
+    for (std::size_t i=0; i != request_to_fill_id.size(); ++i)
+      {
+        const Elem & elem = _mesh.elem_ref(elem_node[2*i]);
+
+        const unsigned int n =
+          cast_int<unsigned int>(elem_node[2*i+1]);
+        libmesh_assert_less (n, elem.n_nodes());
+
+        // This isn't a safe assertion in the case where we're
+        // synching processor ids
+        // libmesh_assert_equal_to (node->processor_id(), comm.rank());
+
+        request_to_fill_id[i] = elem.node_id(n);
+      }
+
+    _sync.gather_data(request_to_fill_id, data);
+  }
+
+  MeshBase & _mesh;
+  SyncFunctor & _sync;
+};
+
+
+
+template <typename SyncFunctor>
+struct SyncActOnRequestedIds
+{
+  SyncActOnRequestedIds(const std::map<processor_id_type, std::vector<dof_id_type> > & requested_ids,
+                        SyncFunctor & sync) :
+    _requested_ids(requested_ids), _sync(sync) {}
+
+  template <typename Query>
+  void operator() (processor_id_type pid,
+                   const std::vector<Query> &,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    std::map<processor_id_type, std::vector<dof_id_type> >::const_iterator
+      ids_it = _requested_ids.find(pid);
+    libmesh_assert(ids_it != _requested_ids.end());
+    libmesh_assert_equal_to (ids_it->second.size(), data.size());
+
+    _sync.act_on_data(ids_it->second, data);
+  }
+
+  const std::map<processor_id_type, std::vector<dof_id_type> > & _requested_ids;
+  SyncFunctor & _sync;
+};
+
+
+
+// As above, for SyncFunctors whose act_on_data() reports whether any
+// data changed
+template <typename SyncFunctor>
+struct SyncActOnRequestedIdsTrackingChanges
+{
+  SyncActOnRequestedIdsTrackingChanges(const std::map<processor_id_type, std::vector<dof_id_type> > & requested_ids,
+                                       SyncFunctor & sync) :
+    _requested_ids(requested_ids), _sync(sync), data_changed(false) {}
+
+  template <typename Query>
+  void operator() (processor_id_type pid,
+                   const std::vector<Query> &,
+                   std::vector<typename SyncFunctor::datum> & data)
+  {
+    std::map<processor_id_type, std::vector<dof_id_type> >::const_iterator
+      ids_it = _requested_ids.find(pid);
+    libmesh_assert(ids_it != _requested_ids.end());
+    libmesh_assert_equal_to (ids_it->second.size(), data.size());
+
+    if (_sync.act_on_data(ids_it->second, data))
+      data_changed = true;
+  }
+
+  const std::map<processor_id_type, std::vector<dof_id_type> > & _requested_ids;
+  SyncFunctor & _sync;
+  bool data_changed;
+};
+
+
+
 template <typename Iterator,
           typename DofObjType,
           typename SyncFunctor>
@@ -193,107 +383,37 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
   libmesh_assert(!need_map_update);
 #endif
 
-  // Count the objectss to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
-
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObjType * obj = *it;
-      libmesh_assert (obj);
-      processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<Real> >
-    requested_objs_x(comm.size()),
-    requested_objs_y(comm.size()),
-    requested_objs_z(comm.size());
+  // Request sets to send to each processor, as (x,y,z) triples
+  std::map<processor_id_type, std::vector<Real> >
+    requested_objs_xyz;
   // Corresponding ids to keep track of
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size());
+  std::map<processor_id_type, std::vector<dof_id_type> >
+    requested_objs_id;
 
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_x[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_y[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_z[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       DofObjType * obj = *it;
+      libmesh_assert (obj);
       processor_id_type obj_procid = obj->processor_id();
       if (obj_procid == comm.rank() ||
           obj_procid == DofObject::invalid_processor_id)
         continue;
 
       Point p = location_map.point_of(*obj);
-      requested_objs_x[obj_procid].push_back(p(0));
-      requested_objs_y[obj_procid].push_back(p(1));
-      requested_objs_z[obj_procid].push_back(p(2));
+      std::vector<Real> & xyz = requested_objs_xyz[obj_procid];
+      xyz.push_back(p(0));
+      xyz.push_back(p(1));
+      xyz.push_back(p(2));
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
-    {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<Real> request_to_fill_x,
-        request_to_fill_y,
-        request_to_fill_z;
-      comm.send_receive(procup, requested_objs_x[procup],
-                        procdown, request_to_fill_x);
-      comm.send_receive(procup, requested_objs_y[procup],
-                        procdown, request_to_fill_y);
-      comm.send_receive(procup, requested_objs_z[procup],
-                        procdown, request_to_fill_z);
-
-      // Find the local id of each requested object
-      std::vector<dof_id_type> request_to_fill_id(request_to_fill_x.size());
-      for (std::size_t i=0; i != request_to_fill_x.size(); ++i)
-        {
-          Point pt(request_to_fill_x[i],
-                   request_to_fill_y[i],
-                   request_to_fill_z[i]);
-
-          // Look for this object in the multimap
-          DofObjType * obj = location_map.find(pt);
-
-          // We'd better find every object we're asked for
-          libmesh_assert (obj);
-
-          // Return the object's correct processor id,
-          // and our (correct if it's local) id for it.
-          request_to_fill_id[i] = obj->id();
-        }
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_x[procup].size(),
-                               received_data.size());
+  // Trade requests with the processors we need data from, and let
+  // the user process the results
+  SyncGatherByXyz<DofObjType, SyncFunctor> gather(location_map, sync);
+  SyncActOnRequestedIds<SyncFunctor> act(requested_objs_id, sync);
 
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
-    }
+  comm.sparse_query(requested_objs_xyz, gather, act,
+                    (typename SyncFunctor::datum *)libmesh_nullptr);
 }
 
 
@@ -320,40 +440,17 @@ void sync_dofobject_data_by_id(const Communicator & comm,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
-  // Count the objects to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
+  // Request sets to send to each processor
+  std::map<processor_id_type, std::vector<dof_id_type> >
+    requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
-       DofObject * obj = *it;
+      DofObject * obj = *it;
       libmesh_assert (obj);
 
       // We may want to pass Elem* or Node* to the check function, not
       // just DofObject*
-      if (!dofobj_check(*it))
-        continue;
-
-      processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject * obj = *it;
-
       if (!dofobj_check(*it))
         continue;
 
@@ -365,35 +462,13 @@ void sync_dofobject_data_by_id(const Communicator & comm,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
-    {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<dof_id_type> request_to_fill_id;
-      comm.send_receive(procup, requested_objs_id[procup],
-                        procdown, request_to_fill_id);
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
-    }
+  // Trade requests with the processors we need data from, and let
+  // the user process the results
+  SyncGatherById<SyncFunctor> gather(sync);
+  SyncActOnRequestedIds<SyncFunctor> act(requested_objs_id, sync);
+
+  comm.sparse_query(requested_objs_id, gather, act,
+                    (typename SyncFunctor::datum *)libmesh_nullptr);
 }
 
 
@@ -412,39 +487,18 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
-  // Count the objects to ask each processor about
-  std::vector<dof_id_type>
-    ghost_objects_from_proc(comm.size(), 0);
-
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject * obj = *it;
-      libmesh_assert (obj);
-      processor_id_type obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<dof_id_type> >
-    requested_objs_id(comm.size()),
-    requested_objs_parent_id(comm.size());
-  std::vector<std::vector<unsigned char> >
-    requested_objs_child_num(comm.size());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (processor_id_type p=0; p != comm.size(); ++p)
-    if (p != comm.rank())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_parent_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_child_num[p].reserve(ghost_objects_from_proc[p]);
-      }
+  // Request sets to send to each processor, as (parent id, child
+  // number) pairs
+  std::map<processor_id_type, std::vector<dof_id_type> >
+    requested_objs_parent_child;
+  // Corresponding ids to keep track of
+  std::map<processor_id_type, std::vector<dof_id_type> >
+    requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       Elem * elem = *it;
+      libmesh_assert (elem);
       processor_id_type obj_procid = elem->processor_id();
       if (obj_procid == comm.rank() ||
           obj_procid == DofObject::invalid_processor_id)
@@ -453,58 +507,20 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
       if (!parent || !elem->active())
         continue;
 
+      std::vector<dof_id_type> & parent_child =
+        requested_objs_parent_child[obj_procid];
+      parent_child.push_back(parent->id());
+      parent_child.push_back(parent->which_child_am_i(elem));
       requested_objs_id[obj_procid].push_back(elem->id());
-      requested_objs_parent_id[obj_procid].push_back(parent->id());
-      requested_objs_child_num[obj_procid].push_back
-        (cast_int<unsigned char>
-         (parent->which_child_am_i(elem)));
     }
 
-  // Trade requests with other processors
-  for (processor_id_type p=1; p != comm.size(); ++p)
-    {
-      // Trade my requests with processor procup and procdown
-      const processor_id_type procup =
-        cast_int<processor_id_type>
-        ((comm.rank() + p) % comm.size());
-      const processor_id_type procdown =
-        cast_int<processor_id_type>
-        ((comm.size() + comm.rank() - p) %
-         comm.size());
-      std::vector<dof_id_type>   request_to_fill_parent_id;
-      std::vector<unsigned char> request_to_fill_child_num;
-      comm.send_receive(procup, requested_objs_parent_id[procup],
-                        procdown, request_to_fill_parent_id);
-      comm.send_receive(procup, requested_objs_child_num[procup],
-                        procdown, request_to_fill_child_num);
-
-      // Find the id of each requested element
-      std::size_t request_size = request_to_fill_parent_id.size();
-      std::vector<dof_id_type> request_to_fill_id(request_size);
-      for (std::size_t i=0; i != request_size; ++i)
-        {
-          Elem & parent = mesh.elem_ref(request_to_fill_parent_id[i]);
-          libmesh_assert(parent.has_children());
-          Elem * child = parent.child_ptr(request_to_fill_child_num[i]);
-          libmesh_assert(child);
-          libmesh_assert(child->active());
-          request_to_fill_id[i] = child->id();
-        }
-
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               received_data.size());
+  // Trade requests with the processors we need data from, and let
+  // the user process the results
+  SyncGatherByParentId<SyncFunctor> gather(mesh, sync);
+  SyncActOnRequestedIds<SyncFunctor> act(requested_objs_id, sync);
 
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
-    }
+  comm.sparse_query(requested_objs_parent_child, gather, act,
+                    (typename SyncFunctor::datum *)libmesh_nullptr);
 }
 #else
 template <typename Iterator,
@@ -554,54 +570,14 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
       // otherwise
       need_sync = false;
 
-      // Count the objects to ask each processor about
-      std::vector<dof_id_type>
-        ghost_objects_from_proc(comm.size(), 0);
-
-      for (MeshBase::const_element_iterator it = range_begin;
-           it != range_end; ++it)
-        {
-          const Elem * elem = *it;
-          libmesh_assert (elem);
-
-          if (!elem_check(elem))
-            continue;
-
-          const processor_id_type proc_id = elem->processor_id();
-          if (proc_id == comm.rank() ||
-              proc_id == DofObject::invalid_processor_id)
-            continue;
-
-          for (unsigned int n=0; n != elem->n_nodes(); ++n)
-            {
-              if (!node_check(elem, n))
-                continue;
-
-              ghost_objects_from_proc[proc_id]++;
-            }
-        }
-
-      // Now repeat that iteration, filling request sets this time.
-
-      // Request sets to send to each processor
-      std::vector<std::vector<dof_id_type> >
-        requested_objs_elem_id(comm.size());
-      std::vector<std::vector<unsigned char> >
-        requested_objs_node_num(comm.size());
+      // Request sets to send to each processor, as (element id,
+      // local node number) pairs
+      std::map<processor_id_type, std::vector<dof_id_type> >
+        requested_objs_elem_node;
 
       // Keep track of current local ids for each too
-      std::vector<std::vector<dof_id_type> >
-        requested_objs_id(comm.size());
-
-      // We know how many objects live on each processor, so reserve()
-      // space for each.
-      for (processor_id_type p=0; p != comm.size(); ++p)
-        if (p != comm.rank())
-          {
-            requested_objs_elem_id[p].reserve(ghost_objects_from_proc[p]);
-            requested_objs_node_num[p].reserve(ghost_objects_from_proc[p]);
-            requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-          }
+      std::map<processor_id_type, std::vector<dof_id_type> >
+        requested_objs_id;
 
       for (MeshBase::const_element_iterator it = range_begin;
            it != range_end; ++it)
@@ -624,82 +600,27 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
               if (!node_check(elem, n))
                 continue;
 
-              const Node & node = elem->node_ref(n);
-              const dof_id_type node_id = node.id();
-
-              requested_objs_elem_id[proc_id].push_back(elem_id);
-              requested_objs_node_num[proc_id].push_back
-                (cast_int<unsigned char>(n));
-              requested_objs_id[proc_id].push_back(node_id);
+              std::vector<dof_id_type> & elem_node =
+                requested_objs_elem_node[proc_id];
+              elem_node.push_back(elem_id);
+              elem_node.push_back(n);
+              requested_objs_id[proc_id].push_back(elem->node_id(n));
             }
         }
 
-      // Trade requests with other processors
-      for (processor_id_type p=1; p != comm.size(); ++p)
-        {
-          // Trade my requests with processor procup and procdown
-          const processor_id_type procup =
-            cast_int<processor_id_type>
-            ((comm.rank() + p) % comm.size());
-          const processor_id_type procdown =
-            cast_int<processor_id_type>
-            ((comm.size() + comm.rank() - p) %
-             comm.size());
-
-          libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                                   ghost_objects_from_proc[procup]);
-          libmesh_assert_equal_to (requested_objs_elem_id[procup].size(),
-                                   ghost_objects_from_proc[procup]);
-          libmesh_assert_equal_to (requested_objs_node_num[procup].size(),
-                                   ghost_objects_from_proc[procup]);
-
-          std::vector<dof_id_type>   request_to_fill_elem_id;
-          std::vector<unsigned char> request_to_fill_node_num;
-          comm.send_receive(procup, requested_objs_elem_id[procup],
-                            procdown, request_to_fill_elem_id);
-          comm.send_receive(procup, requested_objs_node_num[procup],
-                            procdown, request_to_fill_node_num);
-
-          // Find the id of each requested element
-          std::size_t request_size = request_to_fill_elem_id.size();
-          std::vector<dof_id_type> request_to_fill_id(request_size);
-          for (std::size_t i=0; i != request_size; ++i)
-            {
-              const Elem & elem = mesh.elem_ref(request_to_fill_elem_id[i]);
-
-              const unsigned int n = request_to_fill_node_num[i];
-              libmesh_assert_less (n, elem.n_nodes());
+      // Trade requests with the processors we need data from, and
+      // let the user process the results.  If any of the results
+      // were different than what the user expected, then we'll need
+      // to sync again just in case this processor has to pass on the
+      // changes to yet another processor.
+      SyncGatherByElemNode<SyncFunctor> gather(mesh, sync);
+      SyncActOnRequestedIdsTrackingChanges<SyncFunctor>
+        act(requested_objs_id, sync);
 
-              const Node & node = elem.node_ref(n);
+      comm.sparse_query(requested_objs_elem_node, gather, act,
+                        (typename SyncFunctor::datum *)libmesh_nullptr);
 
-              // This isn't a safe assertion in the case where we're
-              // synching processor ids
-              // libmesh_assert_equal_to (node->processor_id(), comm.rank());
-
-              request_to_fill_id[i] = node.id();
-            }
-
-          // Gather whatever data the user wants
-          std::vector<typename SyncFunctor::datum> data;
-          sync.gather_data(request_to_fill_id, data);
-
-          // Trade back the results
-          std::vector<typename SyncFunctor::datum> received_data;
-          comm.send_receive(procdown, data,
-                            procup, received_data);
-          libmesh_assert_equal_to (requested_objs_elem_id[procup].size(),
-                                   received_data.size());
-
-          // Let the user process the results.  If any of the results
-          // were different than what the user expected, then we'll
-          // need to sync again just in case this processor has to
-          // pass on the changes to yet another processor.
-          bool data_changed =
-            sync.act_on_data(requested_objs_id[procup], received_data);
-
-          if (data_changed)
-            need_sync = true;
-        }
+      need_sync = act.data_changed;
       comm.max(need_sync);
     } while (need_sync);
 }
@@ -488,8 +488,222 @@ inline void send_receive_vec_of_vec(const unsigned int dest_processor_id,
   request.wait();
 }
 
+
+
+// Helpers for Communicator::sparse_exchange(): post a synchronous
+// nonblocking send of a vector, or receive a vector whose arrival has
+// already been detected by MPI_Iprobe.  Vectors of vectors are packed
+// into a single MPI_PACKED message.
+template <typename T>
+inline void sparse_exchange_send(const libMesh::Parallel::Communicator & comm,
+                                 const unsigned int dest_processor_id,
+                                 const std::vector<T> & buf,
+                                 libMesh::Parallel::Request & req,
+                                 const libMesh::Parallel::MessageTag & tag)
+{
+  libmesh_call_mpi
+    (MPI_Issend (buf.empty() ? libmesh_nullptr : const_cast<T*>(&buf[0]),
+                 libMesh::cast_int<int>(buf.size()),
+                 libMesh::Parallel::StandardType<T>
+                 (buf.empty() ? libmesh_nullptr : &buf[0]),
+                 dest_processor_id,
+                 tag.value(),
+                 comm.get(),
+                 req.get()));
+}
+
+
+
+template <typename T>
+inline void sparse_exchange_send(const libMesh::Parallel::Communicator & comm,
+                                 const unsigned int dest_processor_id,
+                                 const std::vector<std::vector<T> > & buf,
+                                 libMesh::Parallel::Request & req,
+                                 const libMesh::Parallel::MessageTag & tag)
+{
+  // The outer size and each inner size, followed by the inner data
+  int packedsize=0, sendsize=0;
+
+  libmesh_call_mpi
+    (MPI_Pack_size (libMesh::cast_int<int>(buf.size()+1),
+                    libMesh::Parallel::StandardType<unsigned int>(),
+                    comm.get(),
+                    &packedsize));
+  sendsize += packedsize;
+
+  for (std::size_t i=0; i != buf.size(); ++i)
+    if (!buf[i].empty())
+      {
+        libmesh_call_mpi
+          (MPI_Pack_size (libMesh::cast_int<int>(buf[i].size()),
+                          libMesh::Parallel::StandardType<T>(&buf[i][0]),
+                          comm.get(),
+                          &packedsize));
+        sendsize += packedsize;
+      }
+
+  // The buffer has to live until the send completes; Request::wait()
+  // will delete it.
+  std::vector<char> * sendbuf = new std::vector<char>(sendsize);
+  req.add_post_wait_work
+    (new libMesh::Parallel::PostWaitDeleteBuffer<std::vector<char> >(sendbuf));
+
+  int pos=0;
+  unsigned int n = libMesh::cast_int<unsigned int>(buf.size());
+
+  libmesh_call_mpi
+    (MPI_Pack (&n, 1, libMesh::Parallel::StandardType<unsigned int>(),
+               &(*sendbuf)[0], sendsize, &pos, comm.get()));
+
+  for (std::size_t i=0; i != buf.size(); ++i)
+    {
+      n = libMesh::cast_int<unsigned int>(buf[i].size());
+
+      libmesh_call_mpi
+        (MPI_Pack (&n, 1, libMesh::Parallel::StandardType<unsigned int>(),
+                   &(*sendbuf)[0], sendsize, &pos, comm.get()));
+
+      if (!buf[i].empty())
+        libmesh_call_mpi
+          (MPI_Pack (const_cast<T*>(&buf[i][0]),
+                     libMesh::cast_int<int>(buf[i].size()),
+                     libMesh::Parallel::StandardType<T>(&buf[i][0]),
+                     &(*sendbuf)[0], sendsize, &pos, comm.get()));
+    }
+
+  libmesh_call_mpi
+    (MPI_Issend (&(*sendbuf)[0], pos, MPI_PACKED,
+                 dest_processor_id,
+                 tag.value(),
+                 comm.get(),
+                 req.get()));
+}
+
+
+
+template <typename T>
+inline void sparse_exchange_receive(const libMesh::Parallel::Communicator & comm,
+                                    libMesh::Parallel::status stat,
+                                    std::vector<T> & buf,
+                                    const libMesh::Parallel::MessageTag & tag)
+{
+  libMesh::Parallel::StandardType<T> type((T*)libmesh_nullptr);
+
+  int count = 0;
+  libmesh_call_mpi
+    (MPI_Get_count (&stat, type, &count));
+
+  buf.resize(count);
+
+  libmesh_call_mpi
+    (MPI_Recv (buf.empty() ? libmesh_nullptr : &buf[0],
+               count,
+               type,
+               stat.MPI_SOURCE,
+               tag.value(),
+               comm.get(),
+               &stat));
+}
+
+
+
+template <typename T>
+inline void sparse_exchange_receive(const libMesh::Parallel::Communicator & comm,
+                                    libMesh::Parallel::status stat,
+                                    std::vector<std::vector<T> > & buf,
+                                    const libMesh::Parallel::MessageTag & tag)
+{
+  int count = 0;
+  libmesh_call_mpi
+    (MPI_Get_count (&stat, MPI_PACKED, &count));
+
+  std::vector<char> recvbuf(count);
+
+  libmesh_call_mpi
+    (MPI_Recv (recvbuf.empty() ? libmesh_nullptr : &recvbuf[0],
+               count,
+               MPI_PACKED,
+               stat.MPI_SOURCE,
+               tag.value(),
+               comm.get(),
+               &stat));
+
+  libmesh_assert (!recvbuf.empty());
+
+  int pos=0;
+  unsigned int n = 0;
+
+  libmesh_call_mpi
+    (MPI_Unpack (&recvbuf[0], count, &pos,
+                 &n, 1, libMesh::Parallel::StandardType<unsigned int>(),
+                 comm.get()));
+
+  buf.resize(n);
+
+  for (std::size_t i=0; i != buf.size(); ++i)
+    {
+      libmesh_call_mpi
+        (MPI_Unpack (&recvbuf[0], count, &pos,
+                     &n, 1, libMesh::Parallel::StandardType<unsigned int>(),
+                     comm.get()));
+
+      buf[i].resize(n);
+
+      if (!buf[i].empty())
+        libmesh_call_mpi
+          (MPI_Unpack (&recvbuf[0], count, &pos,
+                       &buf[i][0], libMesh::cast_int<int>(n),
+                       libMesh::Parallel::StandardType<T>(&buf[i][0]),
+                       comm.get()));
+    }
+}
+
 #endif // LIBMESH_HAVE_MPI
 
+
+
+// Helper functors for Communicator::sparse_query(): the first
+// sparse_exchange() round gathers responses to incoming queries, the
+// second hands each response to the user along with the query that
+// prompted it.
+template <typename T, typename datum, typename GatherFunctor>
+struct SparseQueryGather
+{
+  SparseQueryGather(GatherFunctor & gather,
+                    std::map<libMesh::processor_id_type, std::vector<datum> > & responses) :
+    _gather(gather), _responses(responses) {}
+
+  void operator() (const libMesh::processor_id_type pid,
+                   std::vector<T> & query)
+  {
+    std::vector<datum> & response = _responses[pid];
+    _gather(pid, query, response);
+  }
+
+  GatherFunctor & _gather;
+  std::map<libMesh::processor_id_type, std::vector<datum> > & _responses;
+};
+
+template <typename T, typename datum, typename ActionFunctor>
+struct SparseQueryAct
+{
+  SparseQueryAct(const std::map<libMesh::processor_id_type, std::vector<T> > & queries,
+                 ActionFunctor & act) :
+    _queries(queries), _act(act) {}
+
+  void operator() (const libMesh::processor_id_type pid,
+                   std::vector<datum> & response)
+  {
+    typename std::map<libMesh::processor_id_type, std::vector<T> >::const_iterator
+      query_it = _queries.find(pid);
+    libmesh_assert(query_it != _queries.end());
+    _act(pid, query_it->second, response);
+  }
+
+  const std::map<libMesh::processor_id_type, std::vector<T> > & _queries;
+  ActionFunctor & _act;
+};
+
 } // Anonymous namespace
 
 
@@ -622,7 +836,8 @@ inline Communicator::Communicator () :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false) {}
+  _I_duped_it(false),
+  _n_sparse_exchanges(0) {}
 
 inline Communicator::Communicator (const communicator & comm) :
 #ifdef LIBMESH_HAVE_MPI
@@ -632,7 +847,8 @@ inline Communicator::Communicator (const communicator & comm) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   this->assign(comm);
 }
@@ -713,7 +929,8 @@ inline Communicator::Communicator (const Communicator &) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   libmesh_not_implemented();
 }
@@ -4102,6 +4319,152 @@ inline void Communicator::broadcast (T &,
 // MPI-encapsulated methods and the implementation works with or
 // without MPI.
 
+template <typename T, typename ActionFunctor>
+inline void Communicator::sparse_exchange(const std::map<processor_id_type, std::vector<T> > & data,
+                                          ActionFunctor & act_on_data) const
+{
+  // This function must be run on all processors at once
+  libmesh_parallel_only(*this);
+
+  LOG_SCOPE("sparse_exchange()", "Parallel");
+
+  typedef typename std::map<processor_id_type, std::vector<T> >::const_iterator
+    data_iterator;
+
+  const processor_id_type my_pid =
+    cast_int<processor_id_type>(this->rank());
+
+  // Anything we send to ourselves gets handled directly
+  const data_iterator self_it = data.find(my_pid);
+  if (self_it != data.end())
+    {
+      std::vector<T> received(self_it->second);
+      act_on_data(my_pid, received);
+    }
+
+#ifdef LIBMESH_HAVE_MPI
+  if (this->size() == 1)
+    {
+      libmesh_assert_equal_to (data.size(), std::size_t(self_it != data.end()));
+      return;
+    }
+
+  // Successive exchanges alternate tags; see _n_sparse_exchanges
+  const MessageTag tag =
+    this->get_unique_tag(19650 + (_n_sparse_exchanges++ % 2));
+
+  std::vector<Request> send_requests
+    (data.size() - (self_it != data.end()));
+
+  std::size_t n_sends = 0;
+  for (data_iterator it = data.begin(); it != data.end(); ++it)
+    {
+      if (it == self_it)
+        continue;
+
+      libmesh_assert_less (it->first, this->size());
+
+      sparse_exchange_send(*this, it->first, it->second,
+                           send_requests[n_sends++], tag);
+    }
+
+#if MPI_VERSION > 2
+  // Nonblocking consensus: receive whatever arrives until every one
+  // of our synchronous sends has been matched, then enter a
+  // nonblocking barrier, and keep receiving until everyone else has
+  // entered it too.  At that point every message has been received.
+  Request barrier_request;
+  bool barrier_started = false;
+
+  while (true)
+    {
+      int found = 0;
+      status stat;
+      libmesh_call_mpi
+        (MPI_Iprobe (MPI_ANY_SOURCE, tag.value(), this->get(),
+                     &found, &stat));
+
+      if (found)
+        {
+          std::vector<T> received;
+          sparse_exchange_receive(*this, stat, received, tag);
+          act_on_data(cast_int<processor_id_type>(stat.MPI_SOURCE),
+                      received);
+        }
+      else if (barrier_started)
+        {
+          if (barrier_request.test())
+            break;
+        }
+      else
+        {
+          bool sends_done = true;
+          for (std::size_t i=0; i != n_sends; ++i)
+            if (!send_requests[i].test())
+              {
+                sends_done = false;
+                break;
+              }
+
+          if (sends_done)
+            {
+              libmesh_call_mpi
+                (MPI_Ibarrier (this->get(), barrier_request.get()));
+              barrier_started = true;
+            }
+        }
+    }
+#else
+  // Without MPI_Ibarrier we have to find out how many messages to
+  // expect first.
+  std::vector<unsigned int> sending_to_proc(this->size(), 0);
+  for (data_iterator it = data.begin(); it != data.end(); ++it)
+    if (it != self_it)
+      sending_to_proc[it->first] = 1;
+
+  this->alltoall(sending_to_proc);
+
+  unsigned int n_receives = 0;
+  for (std::size_t p=0; p != sending_to_proc.size(); ++p)
+    n_receives += sending_to_proc[p];
+
+  for (unsigned int r=0; r != n_receives; ++r)
+    {
+      status stat = this->probe(any_source, tag);
+      std::vector<T> received;
+      sparse_exchange_receive(*this, stat, received, tag);
+      act_on_data(cast_int<processor_id_type>(stat.MPI_SOURCE),
+                  received);
+    }
+#endif
+
+  // Our sends are complete; this just frees any packed buffers
+  Parallel::wait(send_requests);
+#else
+  libmesh_assert_equal_to (data.size(), std::size_t(self_it != data.end()));
+#endif
+}
+
+
+
+template <typename T, typename datum, typename GatherFunctor, typename ActionFunctor>
+inline void Communicator::sparse_query(const std::map<processor_id_type, std::vector<T> > & queries,
+                                       GatherFunctor & gather_data,
+                                       ActionFunctor & act_on_data,
+                                       const datum *) const
+{
+  std::map<processor_id_type, std::vector<datum> > responses;
+
+  SparseQueryGather<T, datum, GatherFunctor>
+    gather_responses(gather_data, responses);
+  this->sparse_exchange(queries, gather_responses);
+
+  SparseQueryAct<T, datum, ActionFunctor>
+    act_on_responses(queries, act_on_data);
+  this->sparse_exchange(responses, act_on_responses);
+}
+
+
 template <typename Context, typename Iter, typename OutputIter>
 inline void Communicator::gather_packed_range(const unsigned int root_id,
                                               Context * context,
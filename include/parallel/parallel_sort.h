@@ -44,6 +44,14 @@ namespace Parallel
  * all the processors.  We assume that a Sort
  * is instantiated on all processors.
  *
+ * Two algorithms are available.  By default the keys are split
+ * between processors by sample sort: every processor contributes a
+ * regular sample of its sorted keys, splitters are chosen from the
+ * combined sample, and the keys are redistributed with a single
+ * MPI_Alltoallv.  Alternatively the splitters can be found by
+ * repeated histogramming, with the bins gathered one processor at a
+ * time.
+ *
  * \author Benjamin S. Kirk
  * \author John W. Peterson
  * \date 2007
@@ -53,6 +61,12 @@ template <typename KeyType, typename IdxType=unsigned int>
 class Sort : public ParallelObject
 {
 public:
+  /**
+   * The ways of splitting the keys between processors.
+   */
+  enum Algorithm {SAMPLE_SORT = 0,
+                  BIN_SORT};
+
   /**
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
@@ -73,6 +87,19 @@ public:
    */
   void sort();
 
+  /**
+   * Sets the algorithm used by the next \p sort().  Must be the same
+   * on all processors.
+   */
+  void set_algorithm (const Algorithm algorithm)
+  { _algorithm = algorithm; }
+
+  /**
+   * \returns The algorithm used to split the keys.
+   */
+  Algorithm algorithm () const
+  { return _algorithm; }
+
   /**
    * Return a constant reference to _my_bin.  This allows
    * us to do things like check if sorting was successful
@@ -97,6 +124,11 @@ private:
    */
   bool _bin_is_sorted;
 
+  /**
+   * The algorithm used to split the keys.
+   */
+  Algorithm _algorithm;
+
   /**
    * The raw, unsorted data which will need to
    * be sorted (in parallel) across all
@@ -134,10 +166,25 @@ private:
    */
   void communicate_bins();
 
+  /**
+   * Chooses splitters from a regular sample of the sorted local data
+   * on every processor, and uses them to divide the local data into
+   * bins, one for each processor.
+   */
+  void sample_split ();
+
+  /**
+   * Sends each bin to its processor with one MPI_Alltoallv.  By the
+   * time this function is finished, each processor will hold only
+   * its own bin.
+   */
+  void exchange_bins ();
+
   /**
    * After all the bins have been communicated, we can
    * sort our local bin.  This is nothing more than a
-   * call to std::sort
+   * call to std::sort, except for Hilbert keys, which are
+   * radix sorted.
    */
   void sort_local_bin();
 
@@ -168,6 +168,19 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Copy constructor which sets the beginning and end of the new
+   * range to \p first and \p last.  The pthread implementation of
+   * \p parallel_for() uses this to hand each thread its share.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -220,7 +233,7 @@ public:
   /**
    * \returns The size of the range.
    */
-  int size () const { return (_end -_begin); }
+  std::size_t size () const { return (_end -_begin); }
 
   //------------------------------------------------------------------------
   // Methods that implement Range concept
@@ -271,13 +271,6 @@ void parallel_for (const Range & range, const Body & body)
 {
   Threads::BoolAcquire b(Threads::in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-  if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
-#endif
-
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -340,11 +333,6 @@ void parallel_for (const Range & range, const Body & body)
   // Clean up
   for (unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
-#endif
 }
 
 /**
@@ -368,13 +356,6 @@ void parallel_reduce (const Range & range, Body & body)
 {
   Threads::BoolAcquire b(Threads::in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-  if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
-#endif
-
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -449,11 +430,6 @@ void parallel_reduce (const Range & range, Body & body)
     delete bodies[i];
   for (unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
-#endif
 }
 
 /**
@@ -0,0 +1,79 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PARALLEL_SFC_PARTITIONER_H
+#define LIBMESH_PARALLEL_SFC_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+
+namespace libMesh
+{
+
+/**
+ * The \p ParallelSFCPartitioner orders the active elements along a
+ * Hilbert space filling curve through their centroids, like the
+ * \p HilbertSFCPartitioner, but never gathers the mesh in one place:
+ * each processor computes the Hilbert keys of the elements it owns,
+ * the keys are sorted across all processors with \p Parallel::Sort,
+ * and the sorted curve is cut where the running sum of the element
+ * weights crosses each multiple of the total weight divided by the
+ * number of partitions.  It is therefore suitable for a
+ * \p DistributedMesh.
+ *
+ * Weights are given by \p attach_weights(), one per element id; every
+ * element weighs one when none are attached.
+ *
+ * \brief Partitioner cutting a parallel-sorted Hilbert curve by element weight.
+ */
+class ParallelSFCPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  ParallelSFCPartitioner () {}
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual UniquePtr<Partitioner> clone () const libmesh_override
+  {
+    return UniquePtr<Partitioner>(new ParallelSFCPartitioner());
+  }
+
+  /**
+   * Attach the weights of the elements, indexed by element id.  They
+   * are not copied, so they must outlive the next partitioning.
+   */
+  virtual void attach_weights(ErrorVector * weights) libmesh_override { _weights = weights; }
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) libmesh_override;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_PARALLEL_SFC_PARTITIONER_H
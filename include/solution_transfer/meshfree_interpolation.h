@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/bounding_box.h"
 #include "libmesh/point.h"
 #include "libmesh/parallel_object.h"
 #ifdef LIBMESH_HAVE_NANOFLANN
@@ -65,11 +66,21 @@ public:
    * from other processors, so all interpolation can be performed
    * locally.
    *
+   * DISTRIBUTED_SOURCES keeps the data added on each processor where
+   * it is, so memory does not grow with the global number of source
+   * points.  Calling \p prepare_for_use() with this
+   * \p ParallelizationStrategy only exchanges the bounding box of the
+   * source points on each processor; target points are then sent to
+   * the processors whose boxes may hold their nearest neighbors.
+   * \p interpolate_field_data() must then be called on all
+   * processors at once.
+   *
    * Other \p ParallelizationStrategy techniques will be implemented
    * as needed.
    */
-  enum ParallelizationStrategy {SYNC_SOURCES     = 0,
-                                INVALID_STRATEGY};
+  enum ParallelizationStrategy {SYNC_SOURCES        = 0,
+                                INVALID_STRATEGY,
+                                DISTRIBUTED_SOURCES};
   /**
    * Constructor.
    */
@@ -97,6 +108,19 @@ public:
    */
   virtual void clear();
 
+  /**
+   * Sets the \p ParallelizationStrategy to employ.  Takes effect at
+   * the next \p prepare_for_use().
+   */
+  void set_parallelization_strategy (const ParallelizationStrategy strategy)
+  { _parallelization_strategy = strategy; }
+
+  /**
+   * \returns The \p ParallelizationStrategy employed.
+   */
+  ParallelizationStrategy parallelization_strategy () const
+  { return _parallelization_strategy; }
+
   /**
    * The number of field variables.
    */
@@ -164,10 +188,24 @@ protected:
    */
   virtual void gather_remote_data ();
 
+  /**
+   * Gathers the bounding box of the source points, and the number of
+   * them, from every processor.  Used by the \p DISTRIBUTED_SOURCES
+   * strategy in place of \p gather_remote_data().
+   */
+  virtual void gather_remote_bounding_boxes ();
+
   ParallelizationStrategy  _parallelization_strategy;
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
+
+  /**
+   * The bounding box of the source points on each processor, and the
+   * number of them, for the \p DISTRIBUTED_SOURCES strategy.
+   */
+  std::vector<BoundingBox> _src_bboxes;
+  std::vector<dof_id_type> _src_n_pts;
 };
 
 
@@ -314,6 +352,24 @@ protected:
                             const std::vector<Real>   & src_dist_sqr,
                             std::vector<Number>::iterator & out_it) const;
 
+  /**
+   * Performs inverse distance interpolation from source points whose
+   * values are given directly, \p n_field_variables() of them per
+   * point, rather than through indices into the local sources.
+   */
+  void interpolate_values (const std::vector<Real>   & src_dist_sqr,
+                           const std::vector<Number> & src_vals,
+                           std::vector<Number>::iterator & out_it) const;
+
+  /**
+   * Interpolates at \p tgt_pts with the \p DISTRIBUTED_SOURCES
+   * strategy: each target point is searched for in the local tree
+   * and sent to those processors whose source points may be closer
+   * than the \p _n_interp_pts nearest ones known so far.
+   */
+  void interpolate_distributed (const std::vector<Point> & tgt_pts,
+                                std::vector<Number> & tgt_vals) const;
+
   const Real         _half_power;
   const unsigned int _n_interp_pts;
 
@@ -101,7 +101,9 @@ public:
          const unsigned int m_its) libmesh_override;
 
   /**
-   * This function solves a system whose matrix is a shell matrix.
+   * This function solves a system whose matrix is a shell matrix,
+   * with \p CG or \p BICGSTAB, preconditioned by the shell matrix
+   * diagonal unless the \p IDENTITY_PRECOND is requested.
    */
   virtual std::pair<unsigned int, Real>
   solve (const ShellMatrix<T> & shell_matrix,
@@ -113,7 +115,8 @@ public:
   /**
    * This function solves a system whose matrix is a shell matrix, but
    * a sparse matrix is used as preconditioning matrix, this allowing
-   * other preconditioners than JACOBI.
+   * other preconditioners than JACOBI.  Eigen only uses the diagonal
+   * of \p precond_matrix.
    */
   virtual std::pair<unsigned int, Real>
   solve (const ShellMatrix<T> & shell_matrix,
@@ -136,6 +139,20 @@ private:
    */
   void set_eigen_preconditioner_type ();
 
+  /**
+   * Eigen's iterative solvers need the matrix entries, so shell
+   * matrices are solved here, by a Krylov method which only applies
+   * \p shell_matrix.  \p diagonal is the Jacobi preconditioner, or
+   * \p NULL for none.
+   */
+  std::pair<unsigned int, Real>
+  _solve_shell (const ShellMatrix<T> & shell_matrix,
+                const EigenSparseVector<T> * diagonal,
+                EigenSparseVector<T> & solution,
+                const EigenSparseVector<T> & rhs,
+                const double tol,
+                const unsigned int m_its);
+
   /**
    * Store the result of the last solve.
    */
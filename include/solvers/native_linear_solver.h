@@ -0,0 +1,261 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NATIVE_LINEAR_SOLVER_H
+#define LIBMESH_NATIVE_LINEAR_SOLVER_H
+
+// Local includes
+#include "libmesh/linear_solver.h"
+#include "libmesh/auto_ptr.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DistributedSparseMatrix;
+template <typename T> class DistributedVector;
+
+/**
+ * Krylov solvers which need no external library, selected by the
+ * \p NATIVE_SOLVERS package.  They work with a
+ * \p DistributedSparseMatrix (or a \p ShellMatrix) and
+ * \p DistributedVector, and are the default when libMesh is built
+ * without any other solver package.
+ *
+ * The \p CG, \p BICGSTAB, \p GMRES (restarted every \p restart()
+ * iterations) and \p CHEBYSHEV methods are available, preconditioned
+ * by \p IDENTITY_PRECOND, \p JACOBI_PRECOND, \p ILU_PRECOND (ILU(0)
+ * of each processor's diagonal block) or \p BLOCK_JACOBI_PRECOND
+ * (ILU(0) of one block per thread within each processor's diagonal
+ * block), or by a user \p Preconditioner.  \p ICC_PRECOND is treated
+ * as \p ILU_PRECOND.  \p GMRES and \p BICGSTAB are preconditioned on
+ * the right, so the residual checked against the tolerance is always
+ * that of the unpreconditioned system: the solve stops once
+ * \f$ \|b - Ax\| \le tol \|b\| \f$.
+ *
+ * Vector operations and matrix-vector products are threaded over
+ * the local entries, and the inner products each iteration needs are
+ * summed over the processors together where the method allows it.
+ * \p GMRES orthogonalizes with two passes of classical Gram-Schmidt,
+ * so each iteration needs three reductions however large the basis.
+ * \p CHEBYSHEV estimates the largest eigenvalue of the preconditioned
+ * operator by a few power iterations, and targets the interval from
+ * a tenth of that to 1.1 times it.
+ *
+ * \brief Native parallel Krylov linear solvers.
+ */
+template <typename T>
+class NativeLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   *  Constructor.
+   */
+  NativeLinearSolver (const libMesh::Parallel::Communicator & comm_in
+                      LIBMESH_CAN_DEFAULT_TO_COMMWORLD);
+
+  /**
+   * Destructor.
+   */
+  ~NativeLinearSolver ();
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () libmesh_override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name=libmesh_nullptr) libmesh_override;
+
+  /**
+   * Solves \p matrix \p solution = \p rhs.  The system must be a
+   * \p DistributedSparseMatrix with \p DistributedVector vectors.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * Solves the transposed system, multiplying by the transpose of
+   * \p matrix without forming it unless the preconditioner needs it.
+   */
+  virtual std::pair<unsigned int, Real>
+  adjoint_solve (SparseMatrix<T> & matrix,
+                 NumericVector<T> & solution,
+                 NumericVector<T> & rhs,
+                 const double tol,
+                 const unsigned int m_its) libmesh_override;
+
+  /**
+   * Solves \p matrix \p solution = \p rhs, with the preconditioner
+   * built from \p pc.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & pc,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * Solves a system whose matrix is a shell matrix, preconditioned by
+   * its diagonal unless \p IDENTITY_PRECOND or a user
+   * \p Preconditioner is set.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * Solves a system whose matrix is a shell matrix, with the
+   * preconditioner built from \p precond_matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) libmesh_override;
+
+  /**
+   * \returns The solver's convergence flag
+   */
+  virtual LinearConvergenceReason get_converged_reason() const libmesh_override;
+
+  /**
+   * Sets the number of \p GMRES iterations between restarts.
+   * Defaults to 30.
+   */
+  void set_restart (const unsigned int restart);
+
+  /**
+   * \returns The number of \p GMRES iterations between restarts.
+   */
+  unsigned int restart () const { return _restart; }
+
+  /**
+   * The local parts of the operator and of the preconditioner the
+   * Krylov methods apply, defined in native_linear_solver.C.
+   */
+  class LocalOperator;
+  class LocalPreconditioner;
+
+private:
+
+  /**
+   * Solves with the operator \p A and the preconditioner
+   * \p _local_preconditioner, starting from \p solution.
+   */
+  std::pair<unsigned int, Real>
+  _solve (const LocalOperator & A,
+          DistributedVector<T> & solution,
+          const DistributedVector<T> & rhs,
+          const double tol,
+          const unsigned int m_its);
+
+  /**
+   * Builds \p _local_preconditioner from \p matrix, or keeps the one
+   * built already if \p same_preconditioner is set.
+   */
+  void _build_preconditioner (const DistributedSparseMatrix<T> & matrix);
+
+  /**
+   * Builds a Jacobi preconditioner from a diagonal, or the identity
+   * if \p IDENTITY_PRECOND is set.
+   */
+  void _build_preconditioner (const DistributedVector<T> & diagonal);
+
+  /**
+   * Computes \p r = \p b - A \p x.  \p work is used for a copy of
+   * \p x.
+   */
+  void _residual (const LocalOperator & A,
+                  const std::vector<T> & x,
+                  const std::vector<T> & b,
+                  std::vector<T> & r,
+                  std::vector<T> & work) const;
+
+  /**
+   * Sets \p _reason and \returns \p true if the iteration should stop
+   * at iteration \p its with residual norm \p rnorm.
+   */
+  bool _converged (const Real rnorm,
+                   const Real target,
+                   const unsigned int its,
+                   const unsigned int m_its);
+
+  /**
+   * The Krylov methods.  Each improves \p x towards the solution of
+   * A x = \p b until the residual norm is at most \p target, and
+   * \returns the number of iterations and the last residual norm.
+   */
+  std::pair<unsigned int, Real>
+  _cg (const LocalOperator & A, std::vector<T> & x, const std::vector<T> & b,
+       const Real target, const unsigned int m_its);
+
+  std::pair<unsigned int, Real>
+  _bicgstab (const LocalOperator & A, std::vector<T> & x, const std::vector<T> & b,
+             const Real target, const unsigned int m_its);
+
+  std::pair<unsigned int, Real>
+  _gmres (const LocalOperator & A, std::vector<T> & x, const std::vector<T> & b,
+          const Real target, const unsigned int m_its);
+
+  std::pair<unsigned int, Real>
+  _chebyshev (const LocalOperator & A, std::vector<T> & x, const std::vector<T> & b,
+              const Real target, const unsigned int m_its);
+
+  /**
+   * The preconditioner of the last solve.
+   */
+  UniquePtr<LocalPreconditioner> _local_preconditioner;
+
+  /**
+   * The global index of the first local entry of the vectors of the
+   * current solve.
+   */
+  numeric_index_type _first_local_index;
+
+  /**
+   * The number of \p GMRES iterations between restarts.
+   */
+  unsigned int _restart;
+
+  /**
+   * The result of the last solve.
+   */
+  LinearConvergenceReason _reason;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NATIVE_LINEAR_SOLVER_H
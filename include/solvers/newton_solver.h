@@ -31,6 +31,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+class JacobianShellMatrix;
+
 /**
  * This class defines a solver which uses the default
  * libMesh linear solver in a quasiNewton method to handle a
@@ -152,6 +155,12 @@ protected:
    */
   UniquePtr<LinearSolver<Number> > _linear_solver;
 
+  /**
+   * The Jacobian operator used in place of the system matrix when
+   * the system is \p matrix_free_jacobian.
+   */
+  UniquePtr<JacobianShellMatrix> _jacobian_shell_matrix;
+
   /**
    * This does a line search in the direction opposite \p linear_solution
    * to try and minimize the residual of \p newton_iterate.
@@ -46,6 +46,7 @@ namespace libMesh
 {
 
 // Forward Declarations
+class AsyncFileWriter;
 class Elem;
 class MeshBase;
 
@@ -399,6 +400,19 @@ public:
               const unsigned int write_flags=(WRITE_DATA),
               bool partition_agnostic = true) const;
 
+  /**
+   * Write the systems as above, but build the files in memory and
+   * stage them in \p writer, which writes them to disk on a background
+   * thread.  This returns as soon as the data is serialized, so the
+   * disk I/O can overlap with whatever comes next; call
+   * \p writer.wait() before relying on the files.
+   */
+  void write (const std::string & name,
+              AsyncFileWriter & writer,
+              const XdrMODE,
+              const unsigned int write_flags=(WRITE_DATA),
+              bool partition_agnostic = true) const;
+
   /**
    * \returns \p true when this equation system contains
    * identical data, up to the given threshold.  Delegates
@@ -516,6 +530,16 @@ private:
                    const unsigned int read_flags,
                    bool partition_agnostic = true);
 
+  /**
+   * Actual write implementation, staging the files in \p writer if
+   * it is not null.
+   */
+  void _write_impl (const std::string & name,
+                    const XdrMODE,
+                    const unsigned int write_flags,
+                    bool partition_agnostic,
+                    AsyncFileWriter * writer) const;
+
   /**
    * This function is used in the implementation of add_system,
    * it loops over the nodes and elements of the Mesh, adding the
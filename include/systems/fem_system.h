@@ -82,6 +82,9 @@ public:
    * Prepares \p matrix or \p rhs for matrix assembly.
    * Users may reimplement this to add pre- or post-assembly
    * code before or after calling FEMSystem::assembly()
+   *
+   * In \p matrix_free_jacobian mode only the diagonal of the
+   * Jacobian is assembled, into \p get_jacobian_diagonal().
    */
   virtual void assembly (bool get_residual,
                          bool get_jacobian,
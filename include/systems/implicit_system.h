@@ -356,6 +356,32 @@ public:
    */
   bool zero_out_matrix_and_rhs;
 
+  /**
+   * Set \p matrix_free_jacobian to true (it is false by default)
+   * before the system is initialized to never store the Jacobian.
+   * The system matrix and sparsity pattern are then not allocated,
+   * \p assembly() with \p get_jacobian accumulates only the diagonal
+   * of the Jacobian, in \p get_jacobian_diagonal(), and Newton solves
+   * apply the Jacobian through a \p JacobianShellMatrix instead.
+   * Their linear solver then defaults to Jacobi preconditioning;
+   * choosing a preconditioner which needs matrix entries is an error.
+   *
+   * Only \p FEMSystem assembly supports this so far, and anything
+   * else needing the system matrix (e.g. adjoint or sensitivity
+   * solves) won't work.
+   */
+  bool matrix_free_jacobian;
+
+  /**
+   * \returns The diagonal of the Jacobian accumulated by \p assembly()
+   * in \p matrix_free_jacobian mode.
+   */
+  NumericVector<Number> & get_jacobian_diagonal ()
+  { return this->get_vector("_jacobian_diagonal"); }
+
+  const NumericVector<Number> & get_jacobian_diagonal () const
+  { return this->get_vector("_jacobian_diagonal"); }
+
 protected:
 
   /**
@@ -0,0 +1,128 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_JACOBIAN_SHELL_MATRIX_H
+#define LIBMESH_JACOBIAN_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/shell_matrix.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class ImplicitSystem;
+
+/**
+ * This class applies the Jacobian of an \p ImplicitSystem
+ * without ever storing it, by finite differencing the residual in
+ * the direction of the vector it is applied to:
+ *
+ * J v ~= (R(U + h C v) - R(U)) / h
+ *
+ * where C applies the (homogeneous) constraints of the system.  Each
+ * product therefore costs one residual assembly, which for an
+ * \p FEMSystem is a threaded loop over the element and side
+ * residual callbacks; no matrix or sparsity pattern is ever built.
+ * Constrained rows act as the identity, matching the rows the
+ * assembled system matrix would have after constraint application.
+ *
+ * The diagonal used for Jacobi preconditioning is the one
+ * \p FEMSystem::assembly() accumulates in \p matrix_free_jacobian
+ * mode, from the element Jacobians it computes anyway; only systems
+ * in that mode support \p get_diagonal().
+ *
+ * All overridden virtual functions are documented in
+ * shell_matrix.h.
+ *
+ * \brief Matrix-free Jacobian of an ImplicitSystem.
+ */
+class JacobianShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor; the system is stored by reference.
+   */
+  explicit
+  JacobianShellMatrix (ImplicitSystem & sys);
+
+  /**
+   * Destructor.
+   */
+  virtual ~JacobianShellMatrix ();
+
+  /**
+   * Makes the current solution of the system the linearization
+   * point.  The system \p rhs must already hold the (constrained)
+   * residual at that solution, as it does after
+   * \p assembly(true, ...).
+   */
+  void linearize ();
+
+  virtual numeric_index_type m () const libmesh_override;
+
+  virtual numeric_index_type n () const libmesh_override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const libmesh_override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const libmesh_override;
+
+  virtual void get_diagonal (NumericVector<Number> & dest) const libmesh_override;
+
+  /**
+   * The finite difference step is this times (1 + |U|) / |v|.
+   * Defaults to the square root of machine epsilon.
+   */
+  Real relative_perturbation;
+
+private:
+
+  ImplicitSystem & _sys;
+
+  /**
+   * The solution and residual at the linearization point.
+   */
+  UniquePtr<NumericVector<Number> > _solution;
+  UniquePtr<NumericVector<Number> > _residual;
+
+  /**
+   * Scratch space for the perturbed residual.
+   */
+  UniquePtr<NumericVector<Number> > _perturbed_residual;
+
+  Real _solution_norm;
+
+  /**
+   * The constrained dofs owned by this processor.
+   */
+  std::vector<numeric_index_type> _constrained_local_dofs;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_JACOBIAN_SHELL_MATRIX_H
@@ -0,0 +1,158 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASYNC_FILE_WRITER_H
+#define LIBMESH_ASYNC_FILE_WRITER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class holds the contents of whole files in memory and writes
+ * them to disk on a background thread, so that a checkpoint costs the
+ * simulation only the time it takes to serialize the data.
+ *
+ * Files are staged, typically by an \p Xdr object constructed with a
+ * writer, until \p flush() hands them to the background thread.
+ * Staging is double-buffered: new files can be staged while the
+ * previous batch is still being written, and \p flush() only blocks
+ * if that previous batch has not finished yet.  Once more than
+ * \p max_staged_bytes() are staged the batch is flushed
+ * automatically, so at most two batches (plus one file) are ever held
+ * in memory.
+ *
+ * Every processor stages and writes its own files; no communication
+ * is involved.  Without thread support the "background" writes happen
+ * during \p flush() itself.
+ *
+ * \brief Stages files in memory and writes them in the background.
+ */
+class AsyncFileWriter
+{
+public:
+
+  /**
+   * Constructor.  Staging more than \p max_staged_bytes triggers a
+   * flush.
+   */
+  explicit
+  AsyncFileWriter (const std::size_t max_staged_bytes = 256*1024*1024);
+
+  /**
+   * Destructor.  Writes any staged files and waits for them.
+   */
+  ~AsyncFileWriter ();
+
+  /**
+   * Stages the file \p name with the given \p contents, which are
+   * swapped out of the argument rather than copied.  Flushes the
+   * previously staged files first if the total would exceed
+   * \p max_staged_bytes().
+   */
+  void stage (const std::string & name,
+              std::string & contents);
+
+  /**
+   * Starts writing all staged files on the background thread, after
+   * waiting for any previous flush to finish, and returns.
+   */
+  void flush ();
+
+  /**
+   * Flushes any staged files and blocks until all files are written.
+   * Throws a \p libMesh::FileError if any of them failed.
+   */
+  void wait ();
+
+  /**
+   * \returns \p true if every file staged so far has been written,
+   * without blocking.
+   */
+  bool is_complete () const;
+
+  /**
+   * \returns The number of bytes currently staged and not yet flushed.
+   */
+  std::size_t staged_bytes () const { return _staged_bytes; }
+
+  /**
+   * \returns The number of staged bytes which triggers a flush.
+   */
+  std::size_t max_staged_bytes () const { return _max_staged_bytes; }
+
+private:
+
+  /**
+   * Function object run by the background thread.
+   */
+  class WriteFiles;
+
+  /**
+   * Waits for the background thread, if any, to finish.
+   */
+  void join ();
+
+  /**
+   * Writes the files in \p _flushing, recording the first failure.
+   */
+  void write_files ();
+
+  typedef std::vector<std::pair<std::string, std::string> > FileList;
+
+  const std::size_t _max_staged_bytes;
+
+  /**
+   * The files being staged, and their total size.
+   */
+  FileList _staged;
+  std::size_t _staged_bytes;
+
+  /**
+   * The files being written by the background thread.
+   */
+  FileList _flushing;
+
+  UniquePtr<Threads::Thread> _thread;
+
+  /**
+   * Set by the background thread once it has written \p _flushing.
+   */
+  mutable Threads::atomic<bool> _flushed;
+
+  /**
+   * The name of the first file which could not be written.
+   */
+  std::string _failed_file;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_ASYNC_FILE_WRITER_H
@@ -0,0 +1,631 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CHUNKED_MAPVECTOR_H
+#define LIBMESH_CHUNKED_MAPVECTOR_H
+
+// C++ Includes   -----------------------------------
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+namespace libMesh
+{
+
+/**
+ * This \p chunked_mapvector templated class is a drop-in replacement
+ * for \p mapvector, for use with DistributedMesh, which stores its
+ * values in fixed-size contiguous chunks instead of in a std::map.
+ *
+ * Indices from \p stride_start on are grouped into lanes by their
+ * remainder modulo a stride, and each lane is cut into chunks of
+ * consecutive indices within the lane.  Indices below
+ * \p stride_start are stored with a stride of one.  DistributedMesh
+ * hands out new ids with a stride of n_processors()+1 above the range
+ * it last renumbered, so with that layout the objects each processor
+ * creates, and the ghosts it receives from any one neighbor, fill the
+ * chunks of a single lane densely however many processors there are,
+ * while a renumbered, contiguous id range stays dense as well.
+ *
+ * Lookups are O(1) apart from a search among the lanes in use for a
+ * range of indices, and a chunk is freed as soon as its last value is
+ * erased.
+ *
+ * Unlike \p mapvector, a default-constructed \p Val (i.e. \p NULL for
+ * the pointer types used by DistributedMesh) is treated as "no
+ * entry": iteration skips such values and \p count() reports them as
+ * absent.  Iteration order is by increasing index, as with
+ * \p mapvector.
+ *
+ * Writes have to go through \p operator[] (which returns a proxy
+ * reference) or \p erase() so that the chunk occupancy counts stay
+ * correct; values should not be assigned through dereferenced
+ * iterators.
+ */
+template <typename Val, typename index_t=unsigned int, unsigned int chunk_bits=8>
+class chunked_mapvector
+{
+public:
+  typedef index_t key_type;
+  typedef Val     mapped_type;
+
+  /**
+   * The number of values stored in each chunk.
+   */
+  static const std::size_t chunk_size = std::size_t(1) << chunk_bits;
+
+private:
+  static const std::size_t chunk_mask = chunk_size - 1;
+
+  // Position used for past-the-end iterators, so that they stay
+  // valid when chunks are added or removed.
+  static const std::size_t end_pos = static_cast<std::size_t>(-1);
+
+  struct chunk
+  {
+    chunk() : n_set(0)
+    {
+      std::fill(vals, vals + chunk_size, Val());
+    }
+
+    Val vals[chunk_size];
+    std::size_t n_set;
+  };
+
+  /**
+   * The chunk holding one lane of a block of chunk_size rows.
+   */
+  struct lane_chunk
+  {
+    std::size_t lane;
+    chunk * ch;
+  };
+
+  static bool lane_less (const lane_chunk & lc, const std::size_t lane)
+  { return lc.lane < lane; }
+
+  /**
+   * Values stored by row and lane, where index k (relative to the
+   * start of the region) lies in row k/stride and lane k%stride.
+   * Each block of chunk_size rows keeps the chunks of its lanes in
+   * use, sorted by lane.
+   */
+  class region
+  {
+  public:
+    region (const std::size_t stride) : _stride(stride) {}
+
+    region (const region & other) :
+      _blocks(other._blocks),
+      _stride(other._stride)
+    {
+      for (std::size_t b = 0; b != _blocks.size(); ++b)
+        for (std::size_t i = 0; i != _blocks[b].size(); ++i)
+          _blocks[b][i].ch = new chunk(*_blocks[b][i].ch);
+    }
+
+    ~region () { this->clear(); }
+
+    std::size_t stride () const { return _stride; }
+
+    Val get (const std::size_t k) const
+    {
+      std::size_t b, r, l;
+      this->locate(k, b, r, l);
+      const chunk * ch = this->find_chunk(b, l);
+      return ch ? ch->vals[r] : Val();
+    }
+
+    /**
+     * Stores non-default \p v at \p k.  \returns true if \p k was
+     * empty before.
+     */
+    bool set (const std::size_t k, const Val & v)
+    {
+      std::size_t b, r, l;
+      this->locate(k, b, r, l);
+
+      if (b >= _blocks.size())
+        _blocks.resize(b+1);
+
+      std::vector<lane_chunk> & bl = _blocks[b];
+      typename std::vector<lane_chunk>::iterator it =
+        std::lower_bound(bl.begin(), bl.end(), l, lane_less);
+      if (it == bl.end() || it->lane != l)
+        {
+          lane_chunk lc;
+          lc.lane = l;
+          lc.ch = new chunk();
+          it = bl.insert(it, lc);
+        }
+
+      chunk & ch = *it->ch;
+      Val & old = ch.vals[r];
+      const bool was_empty = (old == Val());
+      if (was_empty)
+        ++ch.n_set;
+      old = v;
+      return was_empty;
+    }
+
+    /**
+     * Clears the value at \p k.  \returns true if there was one.
+     */
+    bool erase (const std::size_t k)
+    {
+      std::size_t b, r, l;
+      this->locate(k, b, r, l);
+      if (b >= _blocks.size())
+        return false;
+
+      std::vector<lane_chunk> & bl = _blocks[b];
+      typename std::vector<lane_chunk>::iterator it =
+        std::lower_bound(bl.begin(), bl.end(), l, lane_less);
+      if (it == bl.end() || it->lane != l)
+        return false;
+
+      Val & v = it->ch->vals[r];
+      if (v == Val())
+        return false;
+
+      v = Val();
+      if (--it->ch->n_set == 0)
+        {
+          delete it->ch;
+          bl.erase(it);
+
+          while (!_blocks.empty() && _blocks.back().empty())
+            _blocks.pop_back();
+        }
+
+      return true;
+    }
+
+    void clear ()
+    {
+      for (std::size_t b = 0; b != _blocks.size(); ++b)
+        for (std::size_t i = 0; i != _blocks[b].size(); ++i)
+          delete _blocks[b][i].ch;
+      _blocks.clear();
+    }
+
+    void swap (region & other)
+    {
+      _blocks.swap(other._blocks);
+      std::swap(_stride, other._stride);
+    }
+
+    /**
+     * \returns The first index at or after \p k which holds a
+     * non-default value, or \p end_pos if there is none.  \p val is
+     * pointed at that value.
+     */
+    std::size_t next_set (const std::size_t k, Val * & val) const
+    {
+      std::size_t b, r, l;
+      this->locate(k, b, r, l);
+
+      for (; b < _blocks.size(); ++b, r = 0, l = 0)
+        {
+          const std::vector<lane_chunk> & bl = _blocks[b];
+          for (; !bl.empty() && r != chunk_size; ++r, l = 0)
+            {
+              typename std::vector<lane_chunk>::const_iterator it =
+                l ? std::lower_bound(bl.begin(), bl.end(), l, lane_less) : bl.begin();
+              for (; it != bl.end(); ++it)
+                if (!(it->ch->vals[r] == Val()))
+                  {
+                    val = &it->ch->vals[r];
+                    return this->index(b, r, it->lane);
+                  }
+            }
+        }
+
+      val = libmesh_nullptr;
+      return end_pos;
+    }
+
+    /**
+     * \returns One past the largest index holding a non-default
+     * value, or 0 if there are none.
+     */
+    std::size_t end_index () const
+    {
+      for (std::size_t b = _blocks.size(); b != 0; --b)
+        {
+          const std::vector<lane_chunk> & bl = _blocks[b-1];
+          for (std::size_t r = chunk_size; !bl.empty() && r != 0; --r)
+            for (std::size_t i = bl.size(); i != 0; --i)
+              if (!(bl[i-1].ch->vals[r-1] == Val()))
+                return this->index(b-1, r-1, bl[i-1].lane) + 1;
+        }
+
+      return 0;
+    }
+
+    /**
+     * \returns The number of chunks allocated.
+     */
+    std::size_t n_chunks () const
+    {
+      std::size_t n = 0;
+      for (std::size_t b = 0; b != _blocks.size(); ++b)
+        n += _blocks[b].size();
+      return n;
+    }
+
+  private:
+    region & operator= (const region &);
+
+    void locate (const std::size_t k, std::size_t & b,
+                 std::size_t & r, std::size_t & l) const
+    {
+      const std::size_t row = k / _stride;
+      l = k - row * _stride;
+      b = row >> chunk_bits;
+      r = row & chunk_mask;
+    }
+
+    std::size_t index (const std::size_t b, const std::size_t r,
+                       const std::size_t l) const
+    {
+      return ((b << chunk_bits) + r) * _stride + l;
+    }
+
+    const chunk * find_chunk (const std::size_t b, const std::size_t l) const
+    {
+      if (b >= _blocks.size())
+        return libmesh_nullptr;
+
+      const std::vector<lane_chunk> & bl = _blocks[b];
+      typename std::vector<lane_chunk>::const_iterator it =
+        std::lower_bound(bl.begin(), bl.end(), l, lane_less);
+      return (it != bl.end() && it->lane == l) ? it->ch : libmesh_nullptr;
+    }
+
+    std::vector<std::vector<lane_chunk> > _blocks;
+    std::size_t _stride;
+  };
+
+public:
+  class const_veclike_iterator;
+
+  /**
+   * Proxy returned by the non-const \p operator[], so that
+   * assignments can keep the chunk occupancy up to date.
+   */
+  class reference
+  {
+  public:
+    reference (chunked_mapvector & m, const index_t k) :
+      _map(m), _key(k) {}
+
+    reference & operator= (const Val & v)
+    {
+      _map.set(_key, v);
+      return *this;
+    }
+
+    reference & operator= (const reference & r)
+    {
+      _map.set(_key, Val(r));
+      return *this;
+    }
+
+    operator Val () const { return _map.get(_key); }
+
+    Val operator-> () const { return _map.get(_key); }
+
+  private:
+    chunked_mapvector & _map;
+    const index_t _key;
+  };
+
+  class veclike_iterator
+  {
+  public:
+    veclike_iterator(chunked_mapvector * m, const std::size_t pos)
+      : _map(m), _pos(pos), _val(libmesh_nullptr) { this->seek(); }
+
+    Val & operator*() const { return *_val; }
+
+    veclike_iterator & operator++() { ++_pos; this->seek(); return *this; }
+
+    veclike_iterator operator++(int) {
+      veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const veclike_iterator & other) const {
+      return _pos == other._pos;
+    }
+
+    bool operator!=(const veclike_iterator & other) const {
+      return _pos != other._pos;
+    }
+
+    /**
+     * \returns The index of the value we point to.
+     */
+    index_t index() const { return cast_int<index_t>(_pos); }
+
+  private:
+    void seek() { _pos = _map->next_set(_pos, _val); }
+
+    chunked_mapvector * _map;
+    std::size_t _pos;
+    Val * _val;
+
+    friend class chunked_mapvector;
+    friend class const_veclike_iterator;
+  };
+
+  class const_veclike_iterator
+  {
+  public:
+    const_veclike_iterator(const chunked_mapvector * m, const std::size_t pos)
+      : _map(m), _pos(pos), _val(libmesh_nullptr) { this->seek(); }
+
+    const_veclike_iterator(const veclike_iterator & i)
+      : _map(i._map), _pos(i._pos), _val(i._val) {}
+
+    const Val & operator*() const { return *_val; }
+
+    const_veclike_iterator & operator++() { ++_pos; this->seek(); return *this; }
+
+    const_veclike_iterator operator++(int) {
+      const_veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const const_veclike_iterator & other) const {
+      return _pos == other._pos;
+    }
+
+    bool operator!=(const const_veclike_iterator & other) const {
+      return _pos != other._pos;
+    }
+
+    /**
+     * \returns The index of the value we point to.
+     */
+    index_t index() const { return cast_int<index_t>(_pos); }
+
+  private:
+    void seek() {
+      Val * val;
+      _pos = _map->next_set(_pos, val);
+      _val = val;
+    }
+
+    const chunked_mapvector * _map;
+    std::size_t _pos;
+    const Val * _val;
+  };
+
+  /**
+   * Stores indices from \p stride_start on with stride \p stride,
+   * and the ones below with a stride of one.
+   */
+  explicit
+  chunked_mapvector(const index_t stride = 1,
+                    const index_t stride_start = 0) :
+    _dense(1),
+    _strided(stride),
+    _stride_start(stride_start),
+    _size(0)
+  {
+    libmesh_assert_greater (stride, 0);
+  }
+
+  chunked_mapvector(const chunked_mapvector & other) :
+    _dense(other._dense),
+    _strided(other._strided),
+    _stride_start(other._stride_start),
+    _size(other._size)
+  {}
+
+  chunked_mapvector & operator= (const chunked_mapvector & other)
+  {
+    if (this != &other)
+      {
+        chunked_mapvector copy(other);
+        this->swap(copy);
+      }
+    return *this;
+  }
+
+  ~chunked_mapvector() { this->clear(); }
+
+  /**
+   * Changes the layout to \p stride from \p stride_start on, moving
+   * any stored values.
+   */
+  void set_stride(const index_t stride, const index_t stride_start = 0)
+  {
+    libmesh_assert_greater (stride, 0);
+
+    if (stride == _strided.stride() && stride_start == _stride_start)
+      return;
+
+    chunked_mapvector relaid(stride, stride_start);
+    for (const_veclike_iterator it = this->begin(); it != this->end(); ++it)
+      relaid.set(it.index(), *it);
+    this->swap(relaid);
+  }
+
+  index_t stride () const { return cast_int<index_t>(_strided.stride()); }
+
+  index_t stride_start () const { return _stride_start; }
+
+  reference operator[] (const index_t & k)
+  {
+    return reference(*this, k);
+  }
+
+  Val operator[] (const index_t & k) const
+  {
+    return this->get(k);
+  }
+
+  /**
+   * \returns 1 if a non-default value is stored at \p k, 0 otherwise.
+   */
+  std::size_t count (const index_t & k) const
+  {
+    return (this->get(k) == Val()) ? 0 : 1;
+  }
+
+  /**
+   * \returns The number of non-default values stored.
+   */
+  std::size_t size () const { return _size; }
+
+  bool empty () const { return _size == 0; }
+
+  /**
+   * \returns The number of chunks allocated, which is what the
+   * storage costs beyond one pointer per lane in use.
+   */
+  std::size_t n_chunks () const
+  {
+    return _dense.n_chunks() + _strided.n_chunks();
+  }
+
+  /**
+   * \returns One past the largest index holding a non-default
+   * value, or 0 if there are none.
+   */
+  index_t end_index () const
+  {
+    const std::size_t strided_end = _strided.end_index();
+    if (strided_end)
+      return cast_int<index_t>(strided_end + _stride_start);
+
+    return cast_int<index_t>(_dense.end_index());
+  }
+
+  void erase(index_t k)
+  {
+    const bool erased = (k < _stride_start) ?
+      _dense.erase(k) : _strided.erase(k - _stride_start);
+    if (erased)
+      --_size;
+  }
+
+  void erase(const veclike_iterator & pos) {
+    this->erase(pos.index());
+  }
+
+  /**
+   * Removes all values.  The layout is kept.
+   */
+  void clear()
+  {
+    _dense.clear();
+    _strided.clear();
+    _size = 0;
+  }
+
+  void swap(chunked_mapvector & other)
+  {
+    _dense.swap(other._dense);
+    _strided.swap(other._strided);
+    std::swap(_stride_start, other._stride_start);
+    std::swap(_size, other._size);
+  }
+
+  veclike_iterator begin() {
+    return veclike_iterator(this, 0);
+  }
+
+  const_veclike_iterator begin() const {
+    return const_veclike_iterator(this, 0);
+  }
+
+  veclike_iterator end() {
+    return veclike_iterator(this, end_pos);
+  }
+
+  const_veclike_iterator end() const {
+    return const_veclike_iterator(this, end_pos);
+  }
+
+private:
+
+  Val get (const index_t k) const
+  {
+    return (k < _stride_start) ?
+      _dense.get(k) : _strided.get(k - _stride_start);
+  }
+
+  void set (const index_t k, const Val & v)
+  {
+    if (v == Val())
+      {
+        this->erase(k);
+        return;
+      }
+
+    const bool added = (k < _stride_start) ?
+      _dense.set(k, v) : _strided.set(k - _stride_start, v);
+    if (added)
+      ++_size;
+  }
+
+  /**
+   * \returns The first position at or after \p pos which holds a
+   * non-default value, or \p end_pos if there is none.  \p val is
+   * pointed at that value.
+   */
+  std::size_t next_set (std::size_t pos, Val * & val) const
+  {
+    val = libmesh_nullptr;
+    if (pos == end_pos)
+      return end_pos;
+
+    if (pos < _stride_start)
+      {
+        const std::size_t next = _dense.next_set(pos, val);
+        if (next != end_pos)
+          return next;
+        pos = _stride_start;
+      }
+
+    const std::size_t next = _strided.next_set(pos - _stride_start, val);
+    return (next == end_pos) ? end_pos : next + _stride_start;
+  }
+
+  region _dense;
+
+  region _strided;
+
+  index_t _stride_start;
+
+  std::size_t _size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_CHUNKED_MAPVECTOR_H
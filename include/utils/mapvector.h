@@ -78,6 +78,11 @@ public:
       return it != other.it;
     }
 
+    /**
+     * \returns The index of the value we point to.
+     */
+    index_t index() const { return it->first; }
+
     typename maptype::iterator it;
   };
 
@@ -111,9 +116,37 @@ public:
       return it != other.it;
     }
 
+    /**
+     * \returns The index of the value we point to.
+     */
+    index_t index() const { return it->first; }
+
     typename maptype::const_iterator it;
   };
 
+  /**
+   * \returns One past the largest index holding a non-default
+   * value, or 0 if there are none.
+   */
+  index_t end_index() const {
+    // Search backwards so we can break out early.  Beware of
+    // default (e.g. NULL) entries that haven't yet been cleared.
+    typename maptype::const_reverse_iterator
+      rit = this->rbegin(),
+      rend = this->rend();
+    for (; rit != rend; ++rit)
+      if (!(rit->second == Val()))
+        return rit->first + 1;
+
+    return 0;
+  }
+
+  /**
+   * Layout hint for \p chunked_mapvector compatibility; a std::map
+   * needs none, so this does nothing.
+   */
+  void set_stride(index_t, index_t = 0) {}
+
   void erase(index_t i) {
     maptype::erase(i);
   }
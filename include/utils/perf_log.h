@@ -27,14 +27,37 @@
 // C++ includes
 #include <cstddef>
 #include <map>
-#include <stack>
 #include <string>
 #include <vector>
 #include <sys/time.h>
+#include <time.h>
 
 namespace libMesh
 {
 
+// Forward Declarations
+namespace Parallel {
+class Communicator;
+}
+
+/**
+ * \returns The current time in seconds, from a monotonic clock where
+ * the system has one.  Only differences between times are meaningful.
+ */
+inline
+double perf_log_time ()
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec)*1.e-9;
+#else
+  struct timeval tv;
+  gettimeofday (&tv, libmesh_nullptr);
+  return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec)*1.e-6;
+#endif
+}
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -53,8 +76,8 @@ public:
   PerfData () :
     tot_time(0.),
     tot_time_incl_sub(0.),
-    tstart(),
-    tstart_incl_sub(),
+    tstart(0.),
+    tstart_incl_sub(0.),
     count(0),
     open(false),
     called_recursively(0)
@@ -72,16 +95,15 @@ public:
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
-   * was last started.
+   * When the event was last started or restarted, as given by
+   * \p perf_log_time().
    */
-  struct timeval tstart;
+  double tstart;
 
   /**
-   * Structure defining when the event
-   * was last started, including sub-events.
+   * When the event was last started, including sub-events.
    */
-  struct timeval tstart_incl_sub;
+  double tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -101,6 +123,12 @@ public:
   double pause ();
   double stopit ();
 
+  /**
+   * Adds the counts and times of \p other, e.g. the same event
+   * logged on another thread, to ours.
+   */
+  PerfData & operator += (const PerfData & other);
+
   int called_recursively;
 
 protected:
@@ -117,6 +145,15 @@ protected:
  * This class is particulary useful for finding performance
  * bottlenecks.
  *
+ * Events may be logged from inside threaded loops: each thread keeps
+ * its own stack of events and its own data, found through
+ * thread-local storage, so logging takes no locks once a thread has
+ * seen an event label.  The logs of all threads are summed up when
+ * the log is printed.  Optionally the start and stop time of every
+ * event can be recorded as well, and written out as a Chrome trace
+ * (chrome://tracing, or https://ui.perfetto.dev) to look at the
+ * timelines of all threads on all processors.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -240,22 +277,118 @@ public:
   double get_elapsed_time() const;
 
   /**
-   * \returns The active time
+   * \returns The active time, i.e. the time spent in logged events,
+   * summed over all threads.
    */
   double get_active_time() const;
 
   /**
-   * Return the PerfData object associated with a label and header.
+   * Return the PerfData object associated with a label and header,
+   * summed over all threads.
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
   /**
-   * \returns the raw underlying data structure for the entire performance log.
+   * \returns the raw underlying data structure for the entire
+   * performance log, summed over all threads.
+   */
+  const std::map < std::pair<std::string, std::string>, PerfData > & get_log_raw() const;
+
+  /**
+   * \returns A string containing the minimum, mean and maximum time
+   * each event took on any processor of \p comm, on processor 0, and
+   * an empty string elsewhere.  This function must be run on all
+   * processors at once.
+   */
+  std::string get_parallel_perf_info(const Parallel::Communicator & comm) const;
+
+  /**
+   * Print the log summed over all processors of \p comm, on
+   * processor 0.  This function must be run on all processors at
+   * once.
+   */
+  void print_parallel_log(const Parallel::Communicator & comm) const;
+
+  /**
+   * Start recording the start and stop time of every event, for
+   * \p write_trace().  Every event takes a few more bytes of memory
+   * while tracing is enabled.
+   */
+  void enable_tracing() { trace_events = true; }
+
+  /**
+   * Stop recording event times.  Those already recorded are kept.
    */
-  const std::map < std::pair<std::string, std::string>, PerfData > & get_log_raw() const { return log; }
+  void disable_tracing() { trace_events = false; }
+
+  /**
+   * \returns \p true iff event times are being recorded.
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Writes the recorded events of every thread on every processor of
+   * \p comm to the file \p filename, in the JSON trace event format
+   * read by Chrome's trace viewer.  Processors are shown as processes
+   * and threads as threads; times are measured from when the log was
+   * created or last cleared.  This function must be run on all
+   * processors at once.
+   */
+  void write_trace(const std::string & filename,
+                   const Parallel::Communicator & comm) const;
+
+  /**
+   * Everything logged by one thread.  Each thread only ever touches
+   * its own, so logging needs no locks.
+   */
+  struct ThreadLog;
 
 private:
 
+  /**
+   * An event label, interned so that threads can refer to it by id.
+   */
+  struct Label
+  {
+    unsigned int id;
+    std::string header;
+    std::string label;
+  };
+
+  /**
+   * \returns The log of the calling thread, which is created the
+   * first time a thread logs anything.
+   */
+  ThreadLog & thread_log();
+
+  /**
+   * \returns The id of the event \p label under \p header, which is
+   * created if it is new.
+   */
+  const Label & intern(ThreadLog & tl,
+                       const char * label,
+                       const char * header);
+
+  const Label & intern(ThreadLog & tl,
+                       const std::string & label,
+                       const std::string & header);
+
+  /**
+   * Push and pop the event \p id on the stack of \p tl.
+   */
+  void push(ThreadLog & tl, const unsigned int id);
+  void pop(ThreadLog & tl, const unsigned int id);
+
+  /**
+   * Sums up the logs of all threads into \p log.
+   */
+  void merge_thread_logs() const;
+
+  /**
+   * Deletes the logs of all threads.
+   */
+  void delete_thread_logs();
+
 
   /**
    * The label for this object.
@@ -268,26 +401,43 @@ private:
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * Flag to record the start and stop time of every event.
    */
-  double total_time;
+  bool trace_events;
 
   /**
    * The time we were constructed or last cleared.
    */
-  struct timeval tstart;
+  double tstart;
 
   /**
-   * The actual log.
+   * A number identifying this log, which changes whenever the log is
+   * cleared, so threads know when to forget their old thread logs.
    */
-  std::map<std::pair<std::string,
-                     std::string>,
-           PerfData> log;
+  unsigned int serial;
 
   /**
-   * A stack to hold the current performance log trace.
+   * The logs of every thread which has logged anything.
    */
-  std::stack<PerfData*> log_stack;
+  std::vector<ThreadLog *> thread_logs;
+
+  /**
+   * The labels of every event, in order of their ids.
+   */
+  std::vector<Label *> labels;
+
+  /**
+   * The ids of the labels.
+   */
+  std::map<std::pair<std::string, std::string>, unsigned int> label_ids;
+
+  /**
+   * The log summed over all threads, which \p get_log_raw()
+   * returns.
+   */
+  mutable std::map<std::pair<std::string,
+                             std::string>,
+                   PerfData> log;
 
   /**
    * Flag indicating if print_log() has been called.
@@ -313,7 +463,7 @@ void PerfData::start ()
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  this->tstart = perf_log_time();
   this->tstart_incl_sub = this->tstart;
 }
 
@@ -322,7 +472,7 @@ void PerfData::start ()
 inline
 void PerfData::restart ()
 {
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  this->tstart = perf_log_time();
 }
 
 
@@ -337,26 +487,16 @@ double PerfData::pause ()
 inline
 double PerfData::stop_or_pause(const bool do_stop)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
+  const double tnow = perf_log_time();
 
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  const double elapsed_time = tnow - this->tstart;
 
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-                               static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  this->tstart = tnow;
 
   this->tot_time += elapsed_time;
 
   if (do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-                                            static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
-
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
+    this->tot_time_incl_sub += tnow - this->tstart_incl_sub;
 
   return elapsed_time;
 }
@@ -383,16 +523,8 @@ void PerfLog::push (const std::string & label,
 {
   if (this->log_events)
     {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-
-      if (!log_stack.empty())
-        total_time +=
-          log_stack.top()->pause();
-
-      perf_data->start();
-      log_stack.push(perf_data);
+      ThreadLog & tl = this->thread_log();
+      this->push(tl, this->intern(tl, label, header).id);
     }
 }
 
@@ -403,7 +535,10 @@ void PerfLog::push (const char * label,
                     const char * header)
 {
   if (this->log_events)
-    this->push(std::string(label), std::string(header));
+    {
+      ThreadLog & tl = this->thread_log();
+      this->push(tl, this->intern(tl, label, header).id);
+    }
 }
 
 
@@ -414,41 +549,30 @@ void PerfLog::pop (const std::string & libmesh_dbg_var(label),
 {
   if (this->log_events)
     {
-      libmesh_assert (!log_stack.empty());
-
+      ThreadLog & tl = this->thread_log();
 #ifndef NDEBUG
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
-        {
-          libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          libMesh::err << "From top of stack of running logs:" << std::endl;
-          std::map<std::pair<std::string, std::string>, PerfData>::iterator
-            i = log.begin(), endi = log.end();
-          for (; i != endi; ++i)
-            if (&(i->second) == log_stack.top())
-              libMesh::err << '(' << i->first.first << ',' << i->first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
-        }
+      this->pop(tl, this->intern(tl, label, header).id);
+#else
+      this->pop(tl, static_cast<unsigned int>(-1));
 #endif
-
-      total_time += log_stack.top()->stopit();
-
-      log_stack.pop();
-
-      if (!log_stack.empty())
-        log_stack.top()->restart();
     }
 }
 
 
 
 inline
-void PerfLog::pop(const char * label,
-                  const char * header)
+void PerfLog::pop(const char * libmesh_dbg_var(label),
+                  const char * libmesh_dbg_var(header))
 {
   if (this->log_events)
-    this->pop(std::string(label), std::string(header));
+    {
+      ThreadLog & tl = this->thread_log();
+#ifndef NDEBUG
+      this->pop(tl, this->intern(tl, label, header).id);
+#else
+      this->pop(tl, static_cast<unsigned int>(-1));
+#endif
+    }
 }
 
 
@@ -456,19 +580,7 @@ void PerfLog::pop(const char * label,
 inline
 double PerfLog::get_elapsed_time () const
 {
-  struct timeval tnow;
-
-  gettimeofday (&tnow, libmesh_nullptr);
-
-  const double elapsed_time = (static_cast<double>(tnow.tv_sec  - tstart.tv_sec) +
-                               static_cast<double>(tnow.tv_usec - tstart.tv_usec)*1.e-6);
-  return elapsed_time;
-}
-
-inline
-double PerfLog::get_active_time() const
-{
-  return total_time;
+  return perf_log_time() - tstart;
 }
 
 } // namespace libMesh
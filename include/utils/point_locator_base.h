@@ -128,6 +128,23 @@ public:
                const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr,
                Real tol = TOLERANCE) const;
 
+  /**
+   * Locates each of the \p points at once, filling \p elems with the
+   * element containing each point (or \p NULL in out-of-mesh mode)
+   * and \p reference_points with its coordinates on the reference
+   * element.  Optionally allows the user to restrict the subdomains
+   * searched.
+   *
+   * The base class simply calls \p operator() for each point, but
+   * subclasses can override this to exploit the locality of the
+   * batch.
+   */
+  virtual void
+  locate_points (const std::vector<Point> & points,
+                 std::vector<const Elem *> & elems,
+                 std::vector<Point> & reference_points,
+                 const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
   /**
    * \returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
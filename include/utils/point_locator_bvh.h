@@ -0,0 +1,218 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+#include <set>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a point locator backed by a bounding volume hierarchy over
+ * the bounding boxes of the active elements.  Unlike the trees of
+ * \p PointLocatorTree, which put each element into every bin its
+ * bounding box overlaps, the hierarchy holds each element exactly
+ * once, so elongated or strongly graded elements cost neither extra
+ * memory nor extra depth.
+ *
+ * The hierarchy is built by recursively splitting the elements at the
+ * median of their centroids along the longest axis, and is stored
+ * depth first in one contiguous array, with the element bounding
+ * boxes in another, so that a query touches as little memory as
+ * possible.  Use \p PointLocatorBase::build() with \p BVH to create
+ * objects of this type at run time.
+ *
+ * \brief Point locator using a bounding volume hierarchy.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator, whose hierarchy this
+   * locator will share instead of building its own.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = libmesh_nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() libmesh_override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() libmesh_override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  The element found last time is checked first.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Locates all the elements close to the point with global
+   * coordinates \p p, to within the close-to-point tolerance.
+   * Optionally allows the user to restrict the subdomains searched.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return a NULL pointer instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () libmesh_override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () libmesh_override;
+
+  /**
+   * Set the largest number of elements in a leaf of the hierarchy.
+   * Takes effect at the next \p init().
+   */
+  void set_leaf_size (unsigned int leaf_size);
+
+  /**
+   * Get the largest number of elements in a leaf of the hierarchy.
+   */
+  unsigned int get_leaf_size () const;
+
+  /**
+   * \returns The number of nodes in the hierarchy.
+   */
+  std::size_t n_bvh_nodes () const;
+
+  /**
+   * \returns The number of bytes the hierarchy takes up.
+   */
+  std::size_t memory_usage () const;
+
+private:
+
+  /**
+   * A node of the hierarchy.
+   */
+  struct BVHNode
+  {
+    // The bounding box of everything below this node
+    Real min[LIBMESH_DIM];
+    Real max[LIBMESH_DIM];
+
+    // For a leaf, the first of its elements; for any other node, the
+    // index of its second child, since the first child follows it
+    // directly.
+    dof_id_type first;
+
+    // The number of elements in a leaf, zero for other nodes
+    dof_id_type n_elems;
+  };
+
+  /**
+   * The hierarchy itself, which servant locators share with their
+   * master.
+   */
+  struct Hierarchy
+  {
+    std::vector<BVHNode> nodes;
+
+    // The elements in leaf order, with their bounding boxes (mins
+    // then maxes) stored alongside
+    std::vector<const Elem *> elems;
+    std::vector<Real> elem_boxes;
+
+    // The largest extent of any element, to pad searches for points
+    // close to elements
+    Real max_elem_size;
+  };
+
+  /**
+   * Builds the nodes of the hierarchy for the elements
+   * [\p begin, \p end) of \p order.
+   */
+  void build_node (std::vector<dof_id_type> & order,
+                   const std::vector<Real> & centroids,
+                   const std::vector<Real> & boxes,
+                   const dof_id_type begin,
+                   const dof_id_type end);
+
+  /**
+   * Searches the hierarchy for elements containing \p p, or close to
+   * it if \p close_to_point_tol is positive.  Returns the first one
+   * found, unless \p candidates is given, in which case all of them
+   * are inserted into it.
+   */
+  const Elem * search (const Point & p,
+                       const std::set<subdomain_id_type> * allowed_subdomains,
+                       const Real close_to_point_tol,
+                       std::set<const Elem *> * candidates) const;
+
+  /**
+   * Our hierarchy, or our master's.
+   */
+  Hierarchy * _hierarchy;
+
+  /**
+   * The element found by the last call to \p operator().
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * The largest number of elements in a leaf.
+   */
+  unsigned int _leaf_size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
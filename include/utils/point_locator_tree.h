@@ -115,6 +115,21 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
 
+  /**
+   * Locates each of the \p points at once.  The points are sorted
+   * along a space-filling curve and split into batches, which are
+   * located in parallel on the available threads.  Within a batch each
+   * search starts from the element the previous point was found in,
+   * walking through its neighbors towards the point, and only falls
+   * back on the tree when that fails.  Points the tree can't find
+   * either get the same fallbacks as \p operator() would give them.
+   */
+  virtual void
+  locate_points (const std::vector<Point> & points,
+                 std::vector<const Elem *> & elems,
+                 std::vector<Point> & reference_points,
+                 const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
   /**
    * As a fallback option, it's helpful to be able to do a linear
    * search over the entire mesh. This can be used if operator()
@@ -0,0 +1,281 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SLAB_POOL_H
+#define LIBMESH_SLAB_POOL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A memory pool for many small objects of a few different sizes.
+ * Each object size (rounded up to a multiple of \p alignment) gets
+ * its own size class, which carves objects out of large slabs in
+ * the order they are allocated and keeps a free list of the objects
+ * which have been deallocated, so that they can be reused.  Objects
+ * larger than \p max_object_size are passed on to the global
+ * operator new.
+ *
+ * Slabs are only returned to the system by \p release_memory(), and
+ * only for size classes with no objects left in use.
+ *
+ * Each size class has its own lock, so a pool can be used from
+ * several threads at once.
+ *
+ * \brief Slab allocation with free lists for small objects.
+ */
+class SlabPool
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  SlabPool ();
+
+  /**
+   * Destructor.  Frees every slab, so no object allocated from the
+   * pool may be used afterwards.
+   */
+  ~SlabPool ();
+
+  /**
+   * \returns Memory for an object of \p size bytes.
+   */
+  void * allocate (const std::size_t size);
+
+  /**
+   * Returns the memory \p p of an object of \p size bytes, which must
+   * be the size it was allocated with, to the pool.
+   */
+  void deallocate (void * p, const std::size_t size);
+
+  /**
+   * Returns the memory \p p of an object of unknown size to the pool.
+   * This has to search the slabs for \p p, so it is only meant for
+   * the rare cases where the size isn't available.
+   */
+  void deallocate (void * p);
+
+  /**
+   * Frees the slabs of every size class which has no objects in use.
+   */
+  void release_memory ();
+
+  /**
+   * \returns The number of objects currently allocated from the slabs
+   * of the pool.
+   */
+  std::size_t n_objects () const;
+
+  /**
+   * \returns The number of slabs the pool holds.
+   */
+  std::size_t n_slabs () const;
+
+  /**
+   * \returns The number of bytes in the slabs the pool holds.
+   */
+  std::size_t memory_size () const;
+
+  /**
+   * The granularity of the object sizes, which is also the alignment
+   * of every object in the pool.
+   */
+  static const std::size_t alignment = 16;
+
+  /**
+   * The size of the largest objects the pool keeps in slabs.
+   */
+  static const std::size_t max_object_size = 1024;
+
+  /**
+   * The (minimum) size of each slab, in bytes.
+   */
+  static const std::size_t slab_size = 65536;
+
+private:
+
+  /**
+   * The slabs, free list and counts for objects of one size.
+   */
+  struct SizeClass
+  {
+    SizeClass ();
+
+    /**
+     * The slabs allocated so far.
+     */
+    std::vector<char *> slabs;
+
+    /**
+     * The objects which have been deallocated, each one holding a
+     * pointer to the next.
+     */
+    void * free_list;
+
+    /**
+     * The part of the last slab no object has been carved from yet.
+     */
+    char * next;
+    char * end;
+
+    /**
+     * The number of objects in use.
+     */
+    std::size_t n_objects;
+
+    /**
+     * Serializes access to the size class.
+     */
+    mutable Threads::spin_mutex mutex;
+  };
+
+  /**
+   * Frees the slabs of \p size_class.
+   */
+  static void free_slabs (SizeClass & size_class);
+
+  /**
+   * The size classes, indexed by object size divided by
+   * \p alignment.
+   */
+  SizeClass _size_classes[max_object_size / alignment + 1];
+
+  // Pools are not copyable
+  SlabPool (const SlabPool &);
+  SlabPool & operator= (const SlabPool &);
+};
+
+
+
+/**
+ * Classes derived from \p PoolAllocatedObject<T> are allocated by
+ * \p new from a \p SlabPool shared by every class derived from the
+ * same \p T.  Size classes only go by the size of the object, so
+ * e.g. element types of the same size share slabs in the pool of
+ * \p Elem objects, while types of different sizes never do.
+ * Deleting such an object, through a pointer to any base class with
+ * a virtual destructor, returns its memory to the pool.
+ *
+ * Placement and \p std::nothrow new are overloaded as well, since the
+ * class-specific operator new would otherwise hide the global ones.
+ *
+ * If the library is configured with \p --disable-object-pools then
+ * this class does nothing, and objects come from the global
+ * operator new.
+ *
+ * \brief Allocates a class hierarchy from a shared slab pool.
+ */
+template <typename T>
+class PoolAllocatedObject
+{
+public:
+
+#ifdef LIBMESH_ENABLE_OBJECT_POOLS
+  /**
+   * Allocates an object from \p pool().
+   */
+  static void * operator new (std::size_t size)
+  { return pool().allocate(size); }
+
+  /**
+   * Returns an object to \p pool().
+   */
+  static void operator delete (void * p, std::size_t size)
+  { pool().deallocate(p, size); }
+
+  /**
+   * Allocates an object from \p pool(), returning \p NULL on failure.
+   */
+  static void * operator new (std::size_t size, const std::nothrow_t &) throw()
+  {
+    try
+      {
+        return pool().allocate(size);
+      }
+    catch (const std::bad_alloc &)
+      {
+        return libmesh_nullptr;
+      }
+  }
+
+  /**
+   * Returns an object allocated by \p std::nothrow new to \p pool(),
+   * if its constructor throws.
+   */
+  static void operator delete (void * p, const std::nothrow_t &) throw()
+  { pool().deallocate(p); }
+
+  /**
+   * Constructs an object in the memory \p place, like the global
+   * placement new.  The memory does not come from \p pool().
+   */
+  static void * operator new (std::size_t, void * place) throw()
+  { return place; }
+
+  /**
+   * Matches placement new; there is nothing to free.
+   */
+  static void operator delete (void *, void *) throw()
+  {}
+
+  /**
+   * \returns The pool every object derived from \p T is allocated
+   * from.  The pool is never destroyed, so that objects which outlive
+   * the library may still be deleted.
+   */
+  static SlabPool & pool ()
+  {
+    static SlabPool * const the_pool = new SlabPool;
+    return *the_pool;
+  }
+#endif
+
+  /**
+   * Returns the slabs of the pool which hold no objects to the system.
+   */
+  static void release_memory ()
+  {
+#ifdef LIBMESH_ENABLE_OBJECT_POOLS
+    pool().release_memory();
+#endif
+  }
+
+protected:
+
+  /**
+   * Constructor. Protected so that you cannot instantiate a
+   * \p PoolAllocatedObject, only derive from it.
+   */
+  PoolAllocatedObject () {}
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_POOL_H
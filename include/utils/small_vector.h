@@ -0,0 +1,286 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+namespace libMesh
+{
+
+/**
+ * A vector of plain old data which keeps up to \p N values inside
+ * the object itself, and only allocates from the heap when it grows
+ * beyond that.  It offers the parts of the \p std::vector interface
+ * that work with contiguous storage and pointer iterators.
+ *
+ * The size and capacity are stored as <tt>unsigned int</tt>, so a
+ * \p small_vector<unsigned int, 6> takes 32 bytes, compared with 24
+ * bytes for a \p std::vector plus its heap allocation.
+ *
+ * \note As with \p std::vector, inserting or erasing invalidates
+ * iterators, and the capacity does not shrink except by copying or
+ * swapping with a copy.  Ranges inserted must not come from the
+ * vector itself.
+ *
+ * \brief A vector with inline storage for a few values.
+ */
+template <typename T, unsigned int N>
+class small_vector
+{
+public:
+  typedef T                 value_type;
+  typedef T &               reference;
+  typedef const T &         const_reference;
+  typedef T *               pointer;
+  typedef const T *         const_pointer;
+  typedef T *               iterator;
+  typedef const T *         const_iterator;
+  typedef std::size_t       size_type;
+  typedef std::ptrdiff_t    difference_type;
+
+  /**
+   * Constructor.  Creates an empty vector.
+   */
+  small_vector () : _size(0), _capacity(N) {}
+
+  /**
+   * Constructor.  Creates \p n copies of \p val.
+   */
+  explicit
+  small_vector (const size_type n, const T & val = T()) :
+    _size(0), _capacity(N)
+  { this->resize(n, val); }
+
+  /**
+   * Copy constructor.  Only allocates as much memory as \p other
+   * needs for its values.
+   */
+  small_vector (const small_vector & other) :
+    _size(0), _capacity(N)
+  { this->assign(other.begin(), other.end()); }
+
+  /**
+   * Destructor.
+   */
+  ~small_vector ()
+  {
+    if (_capacity != N)
+      delete [] _storage.heap;
+  }
+
+  /**
+   * Assignment operator.
+   */
+  small_vector & operator= (const small_vector & other)
+  {
+    if (&other != this)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  /**
+   * Replaces the contents with the range [\p first, \p last).
+   */
+  template <typename ForwardIterator>
+  void assign (ForwardIterator first, ForwardIterator last)
+  {
+    this->clear();
+    this->reserve(std::distance(first, last));
+    this->insert(this->end(), first, last);
+  }
+
+  size_type size () const { return _size; }
+
+  bool empty () const { return !_size; }
+
+  size_type capacity () const { return _capacity; }
+
+  T * data () { return (_capacity == N) ? _storage.values : _storage.heap; }
+
+  const T * data () const { return (_capacity == N) ? _storage.values : _storage.heap; }
+
+  iterator begin () { return this->data(); }
+
+  const_iterator begin () const { return this->data(); }
+
+  iterator end () { return this->data() + _size; }
+
+  const_iterator end () const { return this->data() + _size; }
+
+  T & operator[] (const size_type i)
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  const T & operator[] (const size_type i) const
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  /**
+   * Removes every value, keeping the capacity.
+   */
+  void clear () { _size = 0; }
+
+  /**
+   * Makes room for at least \p n values.
+   */
+  void reserve (const size_type n)
+  {
+    if (n <= _capacity)
+      return;
+
+    T * new_values = new T[n];
+    std::memcpy(new_values, this->data(), _size * sizeof(T));
+
+    if (_capacity != N)
+      delete [] _storage.heap;
+
+    _storage.heap = new_values;
+    _capacity = cast_int<unsigned int>(n);
+  }
+
+  /**
+   * Resizes to \p n values, filling any new ones with \p val.
+   */
+  void resize (const size_type n, const T & val = T())
+  {
+    if (n > _size)
+      {
+        const T copy = val;
+        this->reserve(n);
+        std::fill(this->data() + _size, this->data() + n, copy);
+      }
+    _size = cast_int<unsigned int>(n);
+  }
+
+  void push_back (const T & val)
+  {
+    const T copy = val;
+    this->grow(_size + 1);
+    this->data()[_size++] = copy;
+  }
+
+  /**
+   * Inserts \p val before \p pos.  \returns An iterator to it.
+   */
+  iterator insert (iterator pos, const T & val)
+  {
+    const T copy = val;
+    const size_type offset = pos - this->begin();
+    this->grow(_size + 1);
+
+    T * values = this->data();
+    std::memmove(values + offset + 1, values + offset,
+                 (_size - offset) * sizeof(T));
+    values[offset] = copy;
+    ++_size;
+
+    return values + offset;
+  }
+
+  /**
+   * Inserts the range [\p first, \p last) before \p pos.
+   */
+  template <typename ForwardIterator>
+  void insert (iterator pos, ForwardIterator first, ForwardIterator last)
+  {
+    const size_type offset = pos - this->begin();
+    const size_type n = std::distance(first, last);
+    this->grow(_size + n);
+
+    T * values = this->data();
+    std::memmove(values + offset + n, values + offset,
+                 (_size - offset) * sizeof(T));
+    for (T * p = values + offset; first != last; ++first, ++p)
+      *p = *first;
+    _size += cast_int<unsigned int>(n);
+  }
+
+  /**
+   * Erases the range [\p first, \p last).  \returns An iterator to
+   * the value after the erased ones.
+   */
+  iterator erase (iterator first, iterator last)
+  {
+    std::memmove(first, last, (this->end() - last) * sizeof(T));
+    _size -= cast_int<unsigned int>(last - first);
+    return first;
+  }
+
+  /**
+   * Swaps the contents with \p other.  Inline values are copied.
+   */
+  void swap (small_vector & other)
+  {
+    std::swap(_size, other._size);
+    std::swap(_capacity, other._capacity);
+    std::swap(_storage, other._storage);
+  }
+
+private:
+
+  /**
+   * Makes room for at least \p n values, at least doubling the
+   * capacity if it has to grow.
+   */
+  void grow (const size_type n)
+  {
+    if (n > _capacity)
+      this->reserve(std::max(n, size_type(2) * _capacity));
+  }
+
+  /**
+   * The number of values.
+   */
+  unsigned int _size;
+
+  /**
+   * The number of values there is room for.  Equal to \p N while the
+   * values are stored inline, and greater than \p N once they are on
+   * the heap.
+   */
+  unsigned int _capacity;
+
+  /**
+   * The inline values, or a pointer to the values on the heap.
+   */
+  union Storage
+  {
+    T * heap;
+    T values[N];
+  };
+
+  Storage _storage;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
@@ -54,6 +54,9 @@ const unsigned int xdr_MAX_STRING_LENGTH=256;
 namespace libMesh
 {
 
+// Forward declarations
+class AsyncFileWriter;
+
 /**
  * This class implements a C++ interface to the XDR
  * (eXternal Data Representation) format.  XDR is useful for
@@ -73,8 +76,15 @@ public:
   /**
    * Constructor.  Takes the filename and the mode.
    * Valid modes are ENCODE, DECODE, READ, and WRITE.
+   *
+   * If a \p writer is given, files opened for writing are built in
+   * memory and staged in the \p writer when they are closed, rather
+   * than written directly.  Compressed files, and binary files on
+   * systems without \p open_memstream(), are still written directly.
    */
-  Xdr (const std::string & name="", const XdrMODE m=UNKNOWN);
+  Xdr (const std::string & name="",
+       const XdrMODE m=UNKNOWN,
+       AsyncFileWriter * writer=libmesh_nullptr);
 
   /**
    * Destructor.  Closes the file if it is open.
@@ -220,8 +230,21 @@ private:
    */
   FILE * fp;
 
+  /**
+   * The memory buffer behind \p fp when staging a binary file.
+   */
+  char * staged_buffer;
+  std::size_t staged_size;
+
 #endif
 
+  /**
+   * The writer to stage files in, if any, and whether the open file
+   * is being staged.
+   */
+  AsyncFileWriter * writer;
+  bool staged_file;
+
   /**
    * The input file stream.
    */
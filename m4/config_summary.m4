@@ -69,6 +69,7 @@ echo Library Features:
 echo '  library warnings................. :' $enablewarnings
 echo '  adaptive mesh refinement......... :' $enableamr
 echo '  blocked matrix/vector storage.... :' $enableblockedstorage
+echo '  chunked DistributedMesh storage.. :' $enablechunkedstorage
 echo '  complex variables................ :' $enablecomplex
 echo '  example suite.................... :' $enableexamples
 echo '  ghosted vectors.................. :' $enableghosted
@@ -84,6 +85,7 @@ echo '  id size (subdomains)............. :' $subdomain_bytes bytes
 echo '  infinite elements................ :' $enableifem
 echo '  Dirichlet constraints............ :' $enabledirichlet
 echo '  node constraints................. :' $enablenodeconstraint
+echo '  object pools..................... :' $enableobjectpools
 echo '  parallel mesh.................... :' $enableparmesh
 echo '  performance logging.............. :' $enableperflog
 echo '  periodic boundary conditions..... :' $enableperiodic
@@ -449,6 +449,42 @@ fi
 
 
 
+# -------------------------------------------------------------
+# Chunked DistributedMesh storage -- enabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(chunked-storage,
+              AS_HELP_STRING([--disable-chunked-storage],
+                             [Store DistributedMesh nodes and elements in a std::map instead of chunked arrays]),
+              enablechunkedstorage=$enableval,
+              enablechunkedstorage=yes)
+
+if test "$enablechunkedstorage" != no ; then
+  AC_DEFINE(ENABLE_CHUNKED_STORAGE, 1,
+            [Flag indicating if DistributedMesh should store nodes and elements in chunked arrays])
+  AC_MSG_RESULT(<<< Configuring library with chunked DistributedMesh storage >>>)
+fi
+# -------------------------------------------------------------
+
+
+
+# -------------------------------------------------------------
+# Slab pools for Elem and Node objects -- enabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(object-pools,
+              AS_HELP_STRING([--disable-object-pools],
+                             [Allocate each element and node with the global operator new instead of from slab pools]),
+              enableobjectpools=$enableval,
+              enableobjectpools=yes)
+
+if test "$enableobjectpools" != no ; then
+  AC_DEFINE(ENABLE_OBJECT_POOLS, 1,
+            [Flag indicating if elements and nodes should be allocated from slab pools])
+  AC_MSG_RESULT(<<< Configuring library with element and node slab pools >>>)
+fi
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Ghosted instead of Serial local vectors -- enabled by default
 # -------------------------------------------------------------
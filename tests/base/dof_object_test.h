@@ -14,7 +14,9 @@
   CPPUNIT_TEST( testSetNSystems );              \
   CPPUNIT_TEST( testSetNVariableGroups );       \
   CPPUNIT_TEST( testManualDofCalculation );     \
-  CPPUNIT_TEST( testJensEftangBug );
+  CPPUNIT_TEST( testJensEftangBug );            \
+  CPPUNIT_TEST( testAddSystems );               \
+  CPPUNIT_TEST( testPackUnpackIndexing );
 
 using namespace libMesh;
 
@@ -185,6 +187,82 @@ public:
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,2,0), static_cast<dof_id_type>(193));
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(1,0,0), static_cast<dof_id_type>(  1));
   }
+
+  // Sets up system \p s of \p aobject with \p nvg variable groups of
+  // two variables with one component each
+  void setUpSystem(DofObject & aobject, unsigned int s, unsigned int nvg)
+  {
+    std::vector<unsigned int> nvpg(nvg, 2);
+    aobject.set_n_vars_per_group (s, nvpg);
+
+    for (unsigned int vg=0; vg<nvg; vg++)
+      {
+        aobject.set_n_comp_group (s, vg, 1);
+        aobject.set_vg_dof_base (s, vg, 100*s + 10*vg);
+      }
+  }
+
+  void checkSystem(const DofObject & aobject, unsigned int s, unsigned int nvg)
+  {
+    CPPUNIT_ASSERT_EQUAL( nvg, aobject.n_var_groups(s) );
+
+    for (unsigned int vg=0; vg<nvg; vg++)
+      for (unsigned int v=0; v<2; v++)
+        CPPUNIT_ASSERT_EQUAL( static_cast<dof_id_type>(100*s + 10*vg + v),
+                              aobject.dof_number(s, 2*vg + v, 0) );
+  }
+
+  void testAddSystems()
+  {
+    // Grow the index buffer one system at a time, from a size
+    // which fits in the object to one which does not
+    DofObject aobject(*instance);
+
+    for (unsigned int s=0; s<4; s++)
+      {
+        aobject.add_system();
+        setUpSystem(aobject, s, s % 2 + 1);
+
+        CPPUNIT_ASSERT_EQUAL( s+1, aobject.n_systems() );
+        for (unsigned int t=0; t<=s; t++)
+          checkSystem(aobject, t, t % 2 + 1);
+      }
+
+    // Copies keep the indices
+    DofObject acopy(aobject);
+    for (unsigned int s=0; s<4; s++)
+      checkSystem(acopy, s, s % 2 + 1);
+
+    aobject.clear_dofs();
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 0, aobject.n_systems() );
+  }
+
+  void testPackUnpackIndexing()
+  {
+    // One layout small enough to be stored in the object, and one
+    // which is not
+    for (unsigned int nvg=1; nvg<=2; nvg++)
+      {
+        DofObject aobject(*instance);
+        aobject.set_n_systems (2);
+        setUpSystem(aobject, 0, nvg);
+        setUpSystem(aobject, 1, 1);
+
+        std::vector<largest_id_type> buffer;
+        aobject.pack_indexing(std::back_inserter(buffer));
+        CPPUNIT_ASSERT_EQUAL( static_cast<std::size_t>(aobject.packed_indexing_size()),
+                              buffer.size() );
+        CPPUNIT_ASSERT_EQUAL( aobject.packed_indexing_size(),
+                              DofObject::unpackable_indexing_size(buffer.begin()) );
+
+        DofObject bobject(*instance);
+        bobject.unpack_indexing(buffer.begin());
+
+        CPPUNIT_ASSERT_EQUAL( (unsigned int) 2, bobject.n_systems() );
+        checkSystem(bobject, 0, nvg);
+        checkSystem(bobject, 1, 1);
+      }
+  }
 };
 
 #endif // #ifdef __dof_object_test_h__
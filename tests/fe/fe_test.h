@@ -11,6 +11,7 @@
 #include <libmesh/mesh.h>
 #include <libmesh/mesh_generation.h>
 #include <libmesh/numeric_vector.h>
+#include <libmesh/quadrature_gauss.h>
 #include <libmesh/system.h>
 
 // Ignore unused parameter warnings coming from cppunit headers
@@ -24,7 +25,8 @@
 #define FETEST                                  \
   CPPUNIT_TEST( testU );                        \
   CPPUNIT_TEST( testGradU );                    \
-  CPPUNIT_TEST( testGradUComp );
+  CPPUNIT_TEST( testGradUComp );               \
+  CPPUNIT_TEST( testShapeArrays );
 
 using namespace libMesh;
 
@@ -264,6 +266,97 @@ public:
 #endif
   }
 
+  void testShapeArrays()
+  {
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    // XYZ elements don't support contiguous storage
+    if (family == XYZ)
+      return;
+
+    // Distort the element so we exercise the non-affine map
+    Point & p0 = _elem->point(0);
+    for (unsigned int d = 0; d != _dim; ++d)
+      p0(d) += 0.05 / (d+1);
+
+    // Requesting second derivatives keeps the reference FE on the
+    // point-by-point map, while the other FE only asks for the
+    // contiguous arrays.
+    UniquePtr<FEBase> fe_ref = FEBase::build(_dim, _fe->get_fe_type());
+    UniquePtr<FEBase> fe_arr = FEBase::build(_dim, _fe->get_fe_type());
+
+    const std::vector<std::vector<Real> > & phi = fe_ref->get_phi();
+    const std::vector<std::vector<Real> > & dphidx = fe_ref->get_dphidx();
+#if LIBMESH_DIM > 1
+    const std::vector<std::vector<Real> > & dphidy = fe_ref->get_dphidy();
+#endif
+#if LIBMESH_DIM > 2
+    const std::vector<std::vector<Real> > & dphidz = fe_ref->get_dphidz();
+#endif
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    fe_ref->get_d2phi();
+#endif
+    const std::vector<Real> & JxW = fe_ref->get_JxW();
+    const std::vector<Point> & xyz = fe_ref->get_xyz();
+
+    const FEShapeArray<Real> & phi_array = fe_arr->get_phi_array();
+    const FEShapeArray<Real> & dphidx_array = fe_arr->get_dphidx_array();
+#if LIBMESH_DIM > 1
+    const FEShapeArray<Real> & dphidy_array = fe_arr->get_dphidy_array();
+#endif
+#if LIBMESH_DIM > 2
+    const FEShapeArray<Real> & dphidz_array = fe_arr->get_dphidz_array();
+#endif
+    const std::vector<Real> & JxW_arr = fe_arr->get_JxW();
+    const std::vector<Point> & xyz_arr = fe_arr->get_xyz();
+
+    QGauss qrule(_dim, FIFTH);
+    fe_ref->attach_quadrature_rule(&qrule);
+    fe_arr->attach_quadrature_rule(&qrule);
+
+    fe_ref->reinit(_elem);
+    fe_arr->reinit(_elem);
+
+    const std::size_t n_qp = qrule.n_points();
+
+    CPPUNIT_ASSERT_EQUAL(n_qp, JxW_arr.size());
+    for (std::size_t qp = 0; qp != n_qp; ++qp)
+      {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(JxW[qp], JxW_arr[qp], TOLERANCE*TOLERANCE);
+        CPPUNIT_ASSERT((xyz[qp] - xyz_arr[qp]).norm() < TOLERANCE*TOLERANCE);
+      }
+
+    CPPUNIT_ASSERT_EQUAL(phi.size(), phi_array.size());
+    CPPUNIT_ASSERT_EQUAL(n_qp, phi_array.n_points());
+    CPPUNIT_ASSERT_EQUAL(phi.size(), dphidx_array.size());
+
+    for (std::size_t i = 0; i != phi.size(); ++i)
+      {
+        // Rows of the arrays start on aligned boundaries
+        CPPUNIT_ASSERT_EQUAL(std::size_t(0),
+                             reinterpret_cast<std::size_t>(phi_array[i].data()) %
+                             FEShapeArray<Real>::alignment);
+
+        for (std::size_t qp = 0; qp != n_qp; ++qp)
+          {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(phi[i][qp], phi_array[i][qp],
+                                         TOLERANCE*TOLERANCE);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(dphidx[i][qp], dphidx_array[i][qp],
+                                         TOLERANCE*sqrt(TOLERANCE));
+#if LIBMESH_DIM > 1
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(dphidy[i][qp], dphidy_array[i][qp],
+                                         TOLERANCE*sqrt(TOLERANCE));
+#endif
+#if LIBMESH_DIM > 2
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(dphidz[i][qp], dphidz_array[i][qp],
+                                         TOLERANCE*sqrt(TOLERANCE));
+#endif
+          }
+      }
+  }
+
 };
 
 // THE CPPUNIT_TEST_SUITE_END macro expands to code that involves